@@ -713,6 +713,37 @@ void ImGui_ImplOpenGL3_DestroyFontsTexture()
     }
 }
 
+ImTextureID ImGui_ImplOpenGL3_UpdateTexture(ImTextureID tex, int width, int height, const void* pixels, void*)
+{
+    // Upload texture to graphics system, creating it if needed (nearest sampling, so that each texel stays a crisp cell)
+    GLint last_texture;
+    GL_CALL(glGetIntegerv(GL_TEXTURE_BINDING_2D, &last_texture));
+    GLuint texture = (GLuint)(intptr_t)tex;
+    if (texture == 0)
+        GL_CALL(glGenTextures(1, &texture));
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, texture));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+    GL_CALL(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+#ifdef GL_UNPACK_ROW_LENGTH // Not on WebGL/ES
+    GL_CALL(glPixelStorei(GL_UNPACK_ROW_LENGTH, 0));
+#endif
+    GL_CALL(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+
+    // Restore state
+    GL_CALL(glBindTexture(GL_TEXTURE_2D, last_texture));
+
+    return (ImTextureID)(intptr_t)texture;
+}
+
+void ImGui_ImplOpenGL3_DestroyTexture(ImTextureID tex, void*)
+{
+    GLuint texture = (GLuint)(intptr_t)tex;
+    if (texture)
+        GL_CALL(glDeleteTextures(1, &texture));
+}
+
 // If you get an error please report on github. You may try different GL context version or GLSL version. See GL<>GLSL version table at the top of this file.
 static bool CheckShader(GLuint handle, const char* desc)
 {
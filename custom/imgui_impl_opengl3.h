@@ -42,6 +42,10 @@ IMGUI_IMPL_API void     ImGui_ImplOpenGL3_DestroyFontsTexture();
 IMGUI_IMPL_API bool     ImGui_ImplOpenGL3_CreateDeviceObjects();
 IMGUI_IMPL_API void     ImGui_ImplOpenGL3_DestroyDeviceObjects();
 
+// (Optional) Create or update an RGBA 32-bit texture, and release it (e.g. for ImPlot::SetTextureCallbacks)
+IMGUI_IMPL_API ImTextureID ImGui_ImplOpenGL3_UpdateTexture(ImTextureID tex, int width, int height, const void* pixels, void* user_data = nullptr);
+IMGUI_IMPL_API void     ImGui_ImplOpenGL3_DestroyTexture(ImTextureID tex, void* user_data = nullptr);
+
 // Configuration flags to add in your imconfig file:
 //#define IMGUI_IMPL_OPENGL_ES2     // Enable ES 2 (Auto-detected on Emscripten)
 //#define IMGUI_IMPL_OPENGL_ES3     // Enable ES 3 (Auto-detected on iOS/Android)
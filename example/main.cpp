@@ -141,6 +141,7 @@ int main(int, char **) {
   IMGUI_CHECKVERSION();
   ImGui::CreateContext();
   ImPlot::CreateContext();
+  ImPlot::AddFontAtlasMarkerSprites(ImGui::GetIO().Fonts);
   ImNodes::CreateContext();
   ImGrid::CreateContext();
   ImGuiIO &io = ImGui::GetIO();
@@ -161,6 +162,8 @@ int main(int, char **) {
   ImGui_ImplGlfw_InstallEmscriptenCanvasResizeCallback("#canvas");
 #endif
   ImGui_ImplOpenGL3_Init(glsl_version);
+  ImPlot::SetTextureCallbacks(ImGui_ImplOpenGL3_UpdateTexture,
+                              ImGui_ImplOpenGL3_DestroyTexture);
 
   // Load Fonts
   // - If no fonts are loaded, dear imgui will use the default font. You can
@@ -130,6 +130,7 @@ You can read releases logs https://github.com/epezent/implot/releases for more d
 #include "implot_internal.h"
 
 #include <stdlib.h>
+#include <chrono>
 
 // Support for pre-1.82 versions. Users on 1.82+ can use 0 (default) flags to mean "all corners" but in order to support older versions we are more explicit.
 #if (IMGUI_VERSION_NUM < 18102) && !defined(ImDrawFlags_RoundCornersAll)
@@ -425,8 +426,24 @@ void SetImGuiContext(ImGuiContext* ctx) {
     ImGui::SetCurrentContext(ctx);
 }
 
+void SetParallelFor(ImPlotParallelFor callback, void* user_data, int min_prims) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    IM_ASSERT_USER_ERROR(min_prims > 0, "min_prims must be greater than 0!");
+    GImPlot->ParallelFor      = callback;
+    GImPlot->ParallelForData  = user_data;
+    GImPlot->ParallelMinPrims = min_prims;
+}
+
+void SetTextureCallbacks(ImPlotTextureUpdate update, ImPlotTextureDestroy destroy, void* user_data) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    GImPlot->TextureUpdate   = update;
+    GImPlot->TextureDestroy  = destroy;
+    GImPlot->TextureUserData = user_data;
+}
+
 ImPlotContext* CreateContext() {
     ImPlotContext* ctx = IM_NEW(ImPlotContext)();
+    ctx->MarkerSprites = nullptr;
     Initialize(ctx);
     if (GImPlot == nullptr)
         SetCurrentContext(ctx);
@@ -438,6 +455,16 @@ void DestroyContext(ImPlotContext* ctx) {
         ctx = GImPlot;
     if (GImPlot == ctx)
         SetCurrentContext(nullptr);
+    RemoveFontAtlasMarkerSprites(ctx);
+    if (ctx->CellScratchDrawList != nullptr)
+        IM_DELETE(ctx->CellScratchDrawList);
+    if (ctx->TextureDestroy != nullptr) {
+        for (int i = 0; i < ctx->HeatmapTextures.GetMapSize(); ++i) {
+            ImPlotHeatmapTexture* tex = ctx->HeatmapTextures.TryGetMapData(i);
+            if (tex != nullptr && tex->Texture != 0)
+                ctx->TextureDestroy(tex->Texture, ctx->TextureUserData);
+        }
+    }
     IM_DELETE(ctx);
 }
 
@@ -457,6 +484,43 @@ void Initialize(ImPlotContext* ctx) {
     ResetCtxForNextAlignedPlots(ctx);
     ResetCtxForNextSubplot(ctx);
 
+    ctx->DataCacheFrame = -1;
+
+    ctx->CurrentVertexCache    = nullptr;
+    ctx->CurrentVertexCacheKey = 0;
+    ctx->VertexCacheVtxStart   = ctx->VertexCacheIdxStart = ctx->VertexCacheCmdStart = 0;
+    ctx->VertexCacheFrame      = -1;
+
+    ctx->CurrentCellCache    = nullptr;
+    ctx->CurrentCellCacheKey = 0;
+    ctx->CellCacheVtxStart   = ctx->CellCacheIdxStart = ctx->CellCacheCmdStart = 0;
+    ctx->CellCacheFrame      = -1;
+    ctx->CurrentCellSetupKey = 0;
+    ctx->CellReplayed        = false;
+    ctx->CellReplayDrawList  = ctx->CellScratchDrawList = nullptr;
+
+    ctx->HeatmapTexturesFrame = -1;
+    ctx->TextureUpdate        = nullptr;
+    ctx->TextureDestroy       = nullptr;
+    ctx->TextureUserData      = nullptr;
+
+    ctx->DigitalRunsFrame = -1;
+
+    ctx->SpatialIndicesFrame = -1;
+
+    ctx->TzSpans.Clear();
+    ctx->TzLastSpan = -1;
+
+    ctx->ParallelFor      = nullptr;
+    ctx->ParallelForData  = nullptr;
+    ctx->ParallelMinPrims = 1000000;
+
+    ctx->ProfilerEnabled     = ctx->ProfilerOverlay = false;
+    ctx->PlotProfileStart    = ctx->ItemProfileStart = 0;
+    ctx->PlotProfileVtxStart = ctx->PlotProfileIdxStart = 0;
+    ctx->ItemProfileVtxStart = ctx->ItemProfileIdxStart = 0;
+    ctx->CacheStatsFrame     = -1;
+
     const ImU32 Deep[]     = {4289753676, 4283598045, 4285048917, 4283584196, 4289950337, 4284512403, 4291005402, 4287401100, 4285839820, 4291671396                        };
     const ImU32 Dark[]     = {4280031972, 4290281015, 4283084621, 4288892568, 4278222847, 4281597951, 4280833702, 4290740727, 4288256409                                    };
     const ImU32 Pastel[]   = {4289639675, 4293119411, 4291161036, 4293184478, 4289124862, 4291624959, 4290631909, 4293712637, 4294111986                                    };
@@ -508,6 +572,7 @@ void ResetCtxForNextPlot(ImPlotContext* ctx) {
     ctx->CurrentPlot  = nullptr;
     ctx->CurrentItem  = nullptr;
     ctx->PreviousItem = nullptr;
+    ctx->CellReplayed = false;
 }
 
 void ResetCtxForNextAlignedPlots(ImPlotContext* ctx) {
@@ -541,6 +606,69 @@ void BustPlotCache() {
     gp.Subplots.Clear();
 }
 
+//-----------------------------------------------------------------------------
+// Profiler Utils
+//-----------------------------------------------------------------------------
+
+double GetProfilerTime() {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void SetProfilerEnabled(bool enabled, bool overlay) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    GImPlot->ProfilerEnabled = enabled;
+    GImPlot->ProfilerOverlay = enabled && overlay;
+}
+
+bool IsProfilerEnabled() {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    return GImPlot->ProfilerEnabled;
+}
+
+bool GetPlotProfile(const char* plot_title_id, ImPlotProfile* profile) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    const ImPlotPlot* plot = GetPlot(plot_title_id);
+    if (plot == nullptr || plot->Profile.Frame < 0)
+        return false;
+    if (profile != nullptr)
+        *profile = plot->Profile;
+    return true;
+}
+
+bool GetItemProfile(const char* plot_title_id, const char* label_id, ImPlotProfile* profile) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    ImPlotPlot* plot = GetPlot(plot_title_id);
+    const ImPlotItem* item = plot != nullptr ? plot->Items.GetItem(ImGui::GetIDWithSeed(label_id, nullptr, plot->Items.ID)) : nullptr;
+    if (item == nullptr || item->Profile.Frame < 0)
+        return false;
+    if (profile != nullptr)
+        *profile = item->Profile;
+    return true;
+}
+
+ImPlotCacheStats GetCacheStats() {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    GetFrameCacheStats();
+    return GImPlot->CacheStatsPrev;
+}
+
+// Renders the last recorded profile of a plot in the bottom left corner of its plot area
+static void RenderProfileOverlay(const ImPlotPlot& plot, ImDrawList& draw_list) {
+    const ImPlotProfile& p = plot.Profile;
+    if (p.Frame < 0)
+        return;
+    char buff[256];
+    ImFormatString(buff, sizeof(buff), "%.3f ms (setup %.3f, ticks %.3f, fit %.3f, render %.3f)\n%d vtx, %d idx, %d prims, %d culled",
+                   p.TotalTime, p.SetupTime, p.LocatorTime, p.FitTime, p.RenderTime, p.Vertices, p.Indices, p.PrimsRendered, p.PrimsCulled);
+    const ImPlotContext& gp = *GImPlot;
+    const ImVec2 size = ImGui::CalcTextSize(buff) + gp.Style.AnnotationPadding * 2;
+    const ImVec2 pos(plot.PlotRect.Min.x + gp.Style.MousePosPadding.x, plot.PlotRect.Max.y - gp.Style.MousePosPadding.y - size.y);
+    ImGui::PushClipRect(plot.PlotRect.Min, plot.PlotRect.Max, true);
+    draw_list.AddRectFilled(pos, pos + size, GetStyleColorU32(ImPlotCol_LegendBg));
+    draw_list.AddText(pos + gp.Style.AnnotationPadding, GetStyleColorU32(ImPlotCol_InlayText), buff);
+    ImGui::PopClipRect();
+}
+
 //-----------------------------------------------------------------------------
 // Legend Utils
 //-----------------------------------------------------------------------------
@@ -904,13 +1032,48 @@ inline int GetTimeStep(int max_divs, ImPlotTimeUnit unit) {
     return 0;
 }
 
+// Civil time conversions are done arithmetically rather than with the C runtime, whose timegm/mktime are slow
+// and whose local time functions serialize on a global lock. Local time uses a cache of UTC offset transitions
+// that is filled from the C runtime on demand, so repeated conversions (e.g. time axis ticks) are lock free.
+
+static const int DaysBeforeMonth[12] = {0, 31, 59, 90, 120, 151, 181, 212, 243, 273, 304, 334};
+
+static inline ImS64 FloorDiv(ImS64 a, ImS64 b) { return a / b - (a % b < 0 ? 1 : 0); }
+
+// Number of leap years in [1, year]
+static inline ImS64 LeapYearsThrough(ImS64 year) { return FloorDiv(year, 4) - FloorDiv(year, 100) + FloorDiv(year, 400); }
+
+// Days since 1970-01-01 of a proleptic Gregorian date. #month is zero indexed; #month and #day may be out of range.
+static inline ImS64 DaysFromCivil(ImS64 year, ImS64 month, ImS64 day) {
+    year  += FloorDiv(month, 12);
+    month -= FloorDiv(month, 12) * 12;
+    return 365 * (year - 1970) + LeapYearsThrough(year - 1) - LeapYearsThrough(1969)
+         + DaysBeforeMonth[month] + (month > 1 && IsLeapYear((int)year)) + day - 1;
+}
+
+// Converts days since 1970-01-01 to a proleptic Gregorian date (H. Hinnant's civil_from_days). #month is zero indexed.
+static inline void CivilFromDays(ImS64 days, int* year, int* month, int* day) {
+    const ImS64 z   = days + 719468; // days since 0000-03-01
+    const ImS64 era = FloorDiv(z, 146097);
+    const ImS64 doe = z - era * 146097;                                  // [0, 146096]
+    const ImS64 yoe = (doe - doe/1460 + doe/36524 - doe/146096) / 365;   // [0, 399]
+    const ImS64 doy = doe - (365*yoe + yoe/4 - yoe/100);                 // [0, 365], from March 1st
+    const ImS64 mp  = (5*doy + 2) / 153;                                 // [0, 11], from March
+    *day   = (int)(doy - (153*mp + 2) / 5 + 1);
+    *month = (int)(mp < 10 ? mp + 2 : mp - 10);
+    *year  = (int)(yoe + era * 400 + (*month <= 1));
+}
+
+// Seconds since 1970-01-01 of the wall clock time in a tm struct, as if it were UTC
+static inline ImS64 SecondsFromCivil(const tm* ptm) {
+    return DaysFromCivil((ImS64)ptm->tm_year + 1900, ptm->tm_mon, ptm->tm_mday) * 86400
+         + (ImS64)ptm->tm_hour * 3600 + (ImS64)ptm->tm_min * 60 + ptm->tm_sec;
+}
+
 ImPlotTime MkGmtTime(struct tm *ptm) {
     ImPlotTime t;
-#ifdef _WIN32
-    t.S = _mkgmtime(ptm);
-#else
-    t.S = timegm(ptm);
-#endif
+    t.S = (time_t)SecondsFromCivil(ptm);
+    GetGmtTime(t, ptm); // normalize out of range fields like timegm
     if (t.S < 0)
         t.S = 0;
     return t;
@@ -918,33 +1081,152 @@ ImPlotTime MkGmtTime(struct tm *ptm) {
 
 tm* GetGmtTime(const ImPlotTime& t, tm* ptm)
 {
+    const ImS64 days = FloorDiv((ImS64)t.S, 86400);
+    const int   secs = (int)((ImS64)t.S - days * 86400);
+    int year, month, day;
+    CivilFromDays(days, &year, &month, &day);
+    ptm->tm_year  = year - 1900;
+    ptm->tm_mon   = month;
+    ptm->tm_mday  = day;
+    ptm->tm_hour  = secs / 3600;
+    ptm->tm_min   = secs / 60 % 60;
+    ptm->tm_sec   = secs % 60;
+    ptm->tm_wday  = (int)((days % 7 + 11) % 7); // 1970-01-01 was a Thursday
+    ptm->tm_yday  = DaysBeforeMonth[month] + (month > 1 && IsLeapYear(year)) + day - 1;
+    ptm->tm_isdst = 0;
+    return ptm;
+}
+
+// Local time conversion through the C runtime
+static tm* SysLocTime(time_t s, tm* ptm) {
 #ifdef _WIN32
-  if (gmtime_s(ptm, &t.S) == 0)
+  if (localtime_s(ptm, &s) == 0)
     return ptm;
   else
     return nullptr;
 #else
-  return gmtime_r(&t.S, ptm);
+    return localtime_r(&s, ptm);
 #endif
 }
 
+// Returns the UTC offset in seconds of local time at #s and whether DST is in effect, using the C runtime
+static int SysLocalOffset(time_t s, bool* is_dst) {
+    tm Tm;
+    if (SysLocTime(s, &Tm) == nullptr) {
+        *is_dst = false;
+        return 0;
+    }
+    *is_dst = Tm.tm_isdst > 0;
+    return (int)(SecondsFromCivil(&Tm) - (ImS64)s);
+}
+
+// Offsets are sampled with this step, so transitions less than a week apart may be missed
+static const time_t TZ_SAMPLE_STEP = 7 * 86400;
+// Transitions are cached for spans of this length (about a year) when a time within them is first converted
+static const time_t TZ_SPAN        = 366 * 86400;
+// The cache is cleared once it holds this many spans
+static const int    TZ_MAX_SPANS   = 512;
+
+// Appends the local time transitions in [s0, s1) to #out. The first entry always starts at #s0.
+static void FindTzTransitions(time_t s0, time_t s1, ImVector<ImPlotTzTransition>& out) {
+    ImPlotTzTransition tr;
+    tr.S      = s0;
+    tr.Offset = SysLocalOffset(s0, &tr.IsDst);
+    out.push_back(tr);
+    for (time_t a = s0; a < s1;) {
+        const time_t b = ImMin(a + TZ_SAMPLE_STEP, s1);
+        const ImPlotTzTransition last = out.back();
+        bool b_dst;
+        const int b_offset = SysLocalOffset(b, &b_dst);
+        if (b_offset != last.Offset || b_dst != last.IsDst) {
+            // bisect to the first second with the new offset
+            time_t lo = a, hi = b;
+            while (hi - lo > 1) {
+                const time_t mid = lo + (hi - lo) / 2;
+                bool mid_dst;
+                const int mid_offset = SysLocalOffset(mid, &mid_dst);
+                if (mid_offset == last.Offset && mid_dst == last.IsDst)
+                    lo = mid;
+                else
+                    hi = mid;
+            }
+            if (hi < s1) {
+                tr.S      = hi;
+                tr.Offset = SysLocalOffset(hi, &tr.IsDst);
+                out.push_back(tr);
+            }
+        }
+        a = b;
+    }
+}
+
+// Returns the cached local time transition in effect at #s, filling the span of time around it from the C runtime if needed.
+// Spans are kept independently, so axes covering decades or jumping between distant times only sample each span once.
+static const ImPlotTzTransition& GetTzTransition(time_t s) {
+    ImPlotContext& gp = *GImPlot;
+    ImS64 index = (ImS64)(s / TZ_SPAN);
+    if (s % TZ_SPAN < 0)
+        index--;
+    ImPlotTzSpan* span = gp.TzLastSpan >= 0 ? gp.TzSpans.GetByIndex(gp.TzLastSpan) : nullptr;
+    if (span == nullptr || span->Index != index) {
+        const ImGuiID key = ImHashData(&index, sizeof(index));
+        span = gp.TzSpans.GetByKey(key);
+        if (span == nullptr || span->Index != index) {
+            if (span == nullptr && gp.TzSpans.GetAliveCount() >= TZ_MAX_SPANS)
+                gp.TzSpans.Clear();
+            span = gp.TzSpans.GetOrAddByKey(key);
+            span->Index = index;
+            span->Transitions.shrink(0);
+            FindTzTransitions((time_t)(index * TZ_SPAN), (time_t)((index + 1) * TZ_SPAN), span->Transitions);
+        }
+        gp.TzLastSpan = gp.TzSpans.GetIndex(span);
+    }
+    const ImVector<ImPlotTzTransition>& trs = span->Transitions;
+    // last transition at or before s
+    int lo = 0, hi = trs.Size - 1;
+    while (lo < hi) {
+        const int mid = (lo + hi + 1) / 2;
+        if (trs[mid].S <= s)
+            lo = mid;
+        else
+            hi = mid - 1;
+    }
+    return trs[lo];
+}
+
+void BustLocalTimeCache() {
+    ImPlotContext& gp = *GImPlot;
+    gp.TzSpans.Clear();
+    gp.TzLastSpan = -1;
+}
+
 ImPlotTime MkLocTime(struct tm *ptm) {
     ImPlotTime t;
-    t.S = mktime(ptm);
+    if (GImPlot == nullptr) {
+        t.S = mktime(ptm);
+    }
+    else {
+        const ImS64 local = SecondsFromCivil(ptm);
+        // the offset at a first guess of the instant is correct unless the wall clock time was skipped
+        const time_t guess  = (time_t)(local - GetTzTransition((time_t)local).Offset);
+        const int    offset = GetTzTransition(guess).Offset;
+        const int    actual = GetTzTransition((time_t)(local - offset)).Offset;
+        // skipped wall clock times are interpreted with the offset before the transition, like mktime
+        t.S = (time_t)(local - ImMin(offset, actual));
+        GetLocTime(t, ptm); // normalize out of range fields like mktime
+    }
     if (t.S < 0)
         t.S = 0;
     return t;
 }
 
 tm* GetLocTime(const ImPlotTime& t, tm* ptm) {
-#ifdef _WIN32
-  if (localtime_s(ptm, &t.S) == 0)
+    if (GImPlot == nullptr)
+        return SysLocTime(t.S, ptm);
+    const ImPlotTzTransition& tr = GetTzTransition(t.S);
+    GetGmtTime(ImPlotTime(t.S + tr.Offset), ptm);
+    ptm->tm_isdst = tr.IsDst ? 1 : 0;
     return ptm;
-  else
-    return nullptr;
-#else
-    return localtime_r(&t.S, ptm);
-#endif
 }
 
 inline ImPlotTime MkTime(struct tm *ptm) {
@@ -1219,6 +1501,11 @@ inline ImPlotDateTimeSpec GetDateTimeFmt(const ImPlotDateTimeSpec* ctx, ImPlotTi
     return fmt;
 }
 
+// Distinguishes time labels of the same value but different format in the ticker label cache
+static inline ImGuiID GetDateTimeKey(const ImPlotDateTimeSpec& fmt) {
+    return (ImGuiID)(1 + fmt.Date + (fmt.Time << 8) + (fmt.UseISO8601 << 16) + (fmt.Use24HourClock << 17));
+}
+
 void Locator_Time(ImPlotTicker& ticker, const ImPlotRange& range, float pixels, bool vertical, ImPlotFormatter formatter, void* formatter_data) {
     IM_ASSERT_USER_ERROR(vertical == false, "Cannot locate Time ticks on vertical axis!");
     (void)vertical;
@@ -1260,10 +1547,10 @@ void Locator_Time(ImPlotTicker& ticker, const ImPlotRange& range, float pixels,
             if (t1 >= t_min && t1 <= t_max) {
                 // minor level 0 tick
                 ftd.Time = t1; ftd.Spec = fmt0;
-                ticker.AddTick(t1.ToDouble(), true, 0, true, Formatter_Time, &ftd);
+                ticker.AddTick(t1.ToDouble(), true, 0, true, Formatter_Time, &ftd, GetDateTimeKey(ftd.Spec));
                 // major level 1 tick
                 ftd.Time = t1; ftd.Spec = last_major_offset < 0 ? fmtf : fmt1;
-                ImPlotTick& tick_maj = ticker.AddTick(t1.ToDouble(), true, 1, true, Formatter_Time, &ftd);
+                ImPlotTick& tick_maj = ticker.AddTick(t1.ToDouble(), true, 1, true, Formatter_Time, &ftd, GetDateTimeKey(ftd.Spec));
                 const char* this_major = ticker.GetText(tick_maj);
                 if (last_major_offset >= 0 && TimeLabelSame(ticker.TextBuffer.Buf.Data + last_major_offset, this_major))
                     tick_maj.ShowLabel = false;
@@ -1276,10 +1563,10 @@ void Locator_Time(ImPlotTicker& ticker, const ImPlotRange& range, float pixels,
                     float px_to_t2 = (float)((t2 - t12).ToDouble()/range.Size()) * pixels;
                     if (t12 >= t_min && t12 <= t_max) {
                         ftd.Time = t12; ftd.Spec = fmt0;
-                        ticker.AddTick(t12.ToDouble(), false, 0, px_to_t2 >= fmt0_width, Formatter_Time, &ftd);
+                        ticker.AddTick(t12.ToDouble(), false, 0, px_to_t2 >= fmt0_width, Formatter_Time, &ftd, GetDateTimeKey(ftd.Spec));
                         if (last_major_offset < 0 && px_to_t2 >= fmt0_width && px_to_t2 >= (fmt1_width + fmtf_width) / 2) {
                             ftd.Time = t12; ftd.Spec = fmtf;
-                            ImPlotTick& tick_maj = ticker.AddTick(t12.ToDouble(), true, 1, true, Formatter_Time, &ftd);
+                            ImPlotTick& tick_maj = ticker.AddTick(t12.ToDouble(), true, 1, true, Formatter_Time, &ftd, GetDateTimeKey(ftd.Spec));
                             last_major_offset = tick_maj.TextOffset;
                         }
                     }
@@ -1305,7 +1592,7 @@ void Locator_Time(ImPlotTicker& ticker, const ImPlotRange& range, float pixels,
             ImPlotTime t = MakeTime(y);
             if (t >= t_min && t <= t_max) {
                 ftd.Time = t; ftd.Spec = fmty;
-                ticker.AddTick(t.ToDouble(), true, 0, true, Formatter_Time, &ftd);
+                ticker.AddTick(t.ToDouble(), true, 0, true, Formatter_Time, &ftd, GetDateTimeKey(ftd.Spec));
             }
         }
     }
@@ -1587,6 +1874,67 @@ void ShowPlotContextMenu(ImPlotPlot& plot) {
 // Axis Utils
 //-----------------------------------------------------------------------------
 
+// Runs the axis locator, or replays its ticks from the previous run if the range, size, scale, format and font
+// are unchanged. Labels are formatted through the ticker's label cache so that panning only formats new values.
+static void LocateTicks(ImPlotAxis& axis, float pixels, bool vertical) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotTicker& ticker = axis.Ticker;
+    if (ImHasFlag(axis.Flags, ImPlotAxisFlags_NoTickCache)) {
+        axis.Locator(ticker, axis.Range, pixels, vertical, axis.Formatter, axis.FormatterData);
+        return;
+    }
+    const ImFont* font      = ImGui::GetFont();
+    const float   font_size = ImGui::GetFontSize();
+    const bool    styles[3] = { gp.Style.UseLocalTime, gp.Style.UseISO8601, gp.Style.Use24HourClock };
+    ImGuiID label_key = ImHashData(&axis.Formatter, sizeof(axis.Formatter));
+    // the default formatter points at the axis' own FormatSpec, so only its contents identify the labels
+    if (axis.FormatterData != axis.FormatSpec)
+        label_key = ImHashData(&axis.FormatterData, sizeof(axis.FormatterData), label_key);
+    if (axis.HasFormatSpec)
+        label_key = ImHashStr(axis.FormatSpec, 0, label_key);
+    label_key = ImHashData(&font, sizeof(font), label_key);
+    label_key = ImHashData(&font_size, sizeof(font_size), label_key);
+    label_key = ImHashData(styles, sizeof(styles), label_key);
+    ImGuiID key = ImHashData(&axis.Range.Min, sizeof(double), label_key);
+    key = ImHashData(&axis.Range.Max, sizeof(double), key);
+    key = ImHashData(&pixels, sizeof(pixels), key);
+    key = ImHashData(&vertical, sizeof(vertical), key);
+    key = ImHashData(&axis.Locator, sizeof(axis.Locator), key);
+    key = ImHashData(&axis.Scale, sizeof(axis.Scale), key);
+    // members of a link group with the same size and format share ticks
+    ImPlotAxisLinkGroup* group = axis.LinkGroup != 0 ? gp.AxisLinkGroups.GetByKey(axis.LinkGroup) : nullptr;
+    ImPlotTickCache* shared = group != nullptr && axis.TickCache.Key != key ? group->GetTickCache(key, ImGui::GetFrameCount()) : nullptr;
+    ImPlotTickCache& cache = shared != nullptr ? *shared : axis.TickCache;
+    const int tick0 = ticker.TickCount(); // ticker may have user custom ticks
+    const int text0 = ticker.TextBuffer.size();
+    if (key != 0 && cache.Key == key) {
+        GetFrameCacheStats().TicksHits++;
+        if (cache.TextBuffer.size() > 0)
+            ticker.TextBuffer.append(cache.TextBuffer.begin(), cache.TextBuffer.end());
+        for (int i = 0; i < cache.Ticks.Size; ++i) {
+            ImPlotTick tick = cache.Ticks[i];
+            if (tick.TextOffset >= 0)
+                tick.TextOffset += text0;
+            ticker.AddTick(tick);
+        }
+        return;
+    }
+    GetFrameCacheStats().TicksMisses++;
+    ticker.LabelKey = label_key == 0 ? 1 : label_key;
+    axis.Locator(ticker, axis.Range, pixels, vertical, axis.Formatter, axis.FormatterData);
+    ticker.LabelKey = 0;
+    cache.Key = key;
+    cache.Ticks.resize(ticker.TickCount() - tick0);
+    for (int i = 0; i < cache.Ticks.Size; ++i) {
+        cache.Ticks[i] = ticker.Ticks[tick0 + i];
+        if (cache.Ticks[i].TextOffset >= 0)
+            cache.Ticks[i].TextOffset -= text0;
+    }
+    cache.TextBuffer.Buf.shrink(0);
+    if (ticker.TextBuffer.size() > text0)
+        cache.TextBuffer.append(ticker.TextBuffer.begin() + text0, ticker.TextBuffer.end());
+}
+
 static inline int AxisPrecision(const ImPlotAxis& axis) {
     const double range = axis.Ticker.TickCount() > 1 ? (axis.Ticker.Ticks[1].PlotPos - axis.Ticker.Ticks[0].PlotPos) : axis.Range.Size();
     return Precision(range);
@@ -1674,6 +2022,10 @@ void PadAndDatumAxesX(ImPlotPlot& plot, float& pad_T, float& pad_B, ImPlotAlignm
     if (align) {
         count_T = count_B = 0;
         float delta_T, delta_B;
+        if (gp.CurrentCellCache != nullptr) {
+            gp.CurrentCellCache->PadH[0] = pad_T;
+            gp.CurrentCellCache->PadH[1] = pad_B;
+        }
         align->Update(pad_T,pad_B,delta_T,delta_B);
         for (int i = IMPLOT_NUM_X_AXES; i-- > 0;) {
             ImPlotAxis& axis = plot.XAxis(i);
@@ -1756,6 +2108,10 @@ void PadAndDatumAxesY(ImPlotPlot& plot, float& pad_L, float& pad_R, ImPlotAlignm
     if (align) {
         count_L = count_R = 0;
         float delta_L, delta_R;
+        if (gp.CurrentCellCache != nullptr) {
+            gp.CurrentCellCache->PadV[0] = pad_L;
+            gp.CurrentCellCache->PadV[1] = pad_R;
+        }
         align->Update(pad_L,pad_R,delta_L,delta_R);
         for (int i = IMPLOT_NUM_Y_AXES; i-- > 0;) {
             ImPlotAxis& axis = plot.YAxis(i);
@@ -2118,6 +2474,55 @@ void ApplyNextPlotData(ImAxis idx) {
     axis.RangeCond        = npd_rngc;
 }
 
+//-----------------------------------------------------------------------------
+// Axis Link Groups
+//-----------------------------------------------------------------------------
+
+// Returns the axis link group #id with the limits its members pushed last frame applied, or nullptr
+static ImPlotAxisLinkGroup* GetAxisLinkGroup(ImGuiID id) {
+    ImPlotAxisLinkGroup* group = GImPlot->AxisLinkGroups.GetByKey(id);
+    const int frame = ImGui::GetFrameCount();
+    if (group != nullptr && group->Frame != frame) {
+        group->Frame = frame;
+        group->Range = group->NextRange;
+    }
+    return group;
+}
+
+ImGuiID CreateAxisLinkGroup(const char* label_id, double v_min, double v_max) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    ImPlotContext& gp = *GImPlot;
+    const ImGuiID id = ImHashStr(label_id);
+    if (gp.AxisLinkGroups.GetByKey(id) == nullptr) {
+        ImPlotAxisLinkGroup& group = *gp.AxisLinkGroups.GetOrAddByKey(id);
+        group.ID    = id;
+        group.Range = group.NextRange = ImPlotRange(v_min, v_max);
+    }
+    return id;
+}
+
+ImPlotRange GetAxisLinkGroupLimits(ImGuiID id) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    ImPlotAxisLinkGroup* group = GetAxisLinkGroup(id);
+    IM_ASSERT_USER_ERROR(group != nullptr, "Unknown axis link group! Did you forget to call CreateAxisLinkGroup()?");
+    return group != nullptr ? group->Range : ImPlotRange();
+}
+
+void SetAxisLinkGroupLimits(ImGuiID id, double v_min, double v_max) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    ImPlotAxisLinkGroup* group = GetAxisLinkGroup(id);
+    IM_ASSERT_USER_ERROR(group != nullptr, "Unknown axis link group! Did you forget to call CreateAxisLinkGroup()?");
+    if (group != nullptr)
+        group->Range = group->NextRange = ImPlotRange(v_min, v_max);
+}
+
+// Publishes a member's limits if they changed this frame (e.g. by input or fitting)
+static void PushAxisLinkGroup(const ImPlotAxis& axis) {
+    ImPlotAxisLinkGroup* group = GetAxisLinkGroup(axis.LinkGroup);
+    if (group != nullptr && (axis.Range.Min != group->Range.Min || axis.Range.Max != group->Range.Max))
+        group->NextRange = axis.Range;
+}
+
 //-----------------------------------------------------------------------------
 // Setup
 //-----------------------------------------------------------------------------
@@ -2180,6 +2585,21 @@ void SetupAxisLinks(ImAxis idx, double* min_lnk, double* max_lnk) {
     axis.PullLinks();
 }
 
+void SetupAxisLinkGroup(ImAxis idx, ImGuiID group_id) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr && !gp.CurrentPlot->SetupLocked,
+                         "Setup needs to be called after BeginPlot and before any setup locking functions (e.g. PlotX)!");
+    ImPlotPlot& plot = *gp.CurrentPlot;
+    ImPlotAxis& axis = plot.Axes[idx];
+    IM_ASSERT_USER_ERROR(axis.Enabled, "Axis is not enabled! Did you forget to call SetupAxis()?");
+    ImPlotAxisLinkGroup* group = GetAxisLinkGroup(group_id);
+    IM_ASSERT_USER_ERROR(group != nullptr, "Unknown axis link group! Did you forget to call CreateAxisLinkGroup()?");
+    if (group == nullptr)
+        return;
+    axis.LinkGroup = group_id;
+    axis.SetRange(group->Range);
+}
+
 void SetupAxisFormat(ImAxis idx, ImPlotFormatter formatter, void* data) {
     ImPlotContext& gp = *GImPlot;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr && !gp.CurrentPlot->SetupLocked,
@@ -2369,10 +2789,238 @@ void SetNextAxesToFit() {
 // BeginPlot
 //-----------------------------------------------------------------------------
 
+static const int CELL_CACHE_MAX_IDLE_FRAMES = 60;
+
+// Hashes the state the draw data of the current subplot cell depends on, other than the user's data. The limits of the
+// axis link groups the cell was recorded with are included if #link_groups is provided.
+static ImGuiID CalcCellCacheKey(const ImPlotPlot& plot, const ImGuiID* link_groups) {
+    ImPlotContext& gp = *GImPlot;
+    const ImPlotSubplot& subplot = *gp.CurrentSubplot;
+    const ImDrawList& draw_list = *ImGui::GetWindowDrawList();
+    ImGuiID key = ImHashData(&plot.FrameRect, sizeof(ImRect), plot.ID);
+    key = ImHashData(&plot.Flags, sizeof(ImPlotFlags), key);
+    key = ImHashData(&plot.Items.Legend.Flags, sizeof(ImPlotLegendFlags), key);
+    key = ImHashData(&plot.Items.Legend.Location, sizeof(ImPlotLocation), key);
+    for (int i = 0; i < ImAxis_COUNT; ++i) {
+        key = ImHashData(&plot.Axes[i].Range, sizeof(ImPlotRange), key);
+        key = ImHashData(&plot.Axes[i].Flags, sizeof(ImPlotAxisFlags), key);
+    }
+    const ImPlotAlignmentData* aligns[2] = { gp.CurrentAlignmentH, gp.CurrentAlignmentV };
+    for (const ImPlotAlignmentData* align : aligns) {
+        if (align != nullptr) {
+            const float pads[2] = { align->PadA, align->PadB };
+            key = ImHashData(pads, sizeof(pads), key);
+        }
+    }
+    key = ImHashData(subplot.RowLinkData.Data, subplot.RowLinkData.size_in_bytes(), key);
+    key = ImHashData(subplot.ColLinkData.Data, subplot.ColLinkData.size_in_bytes(), key);
+    for (int i = 0; link_groups != nullptr && i < ImAxis_COUNT; ++i) {
+        const ImPlotAxisLinkGroup* group = link_groups[i] != 0 ? GetAxisLinkGroup(link_groups[i]) : nullptr;
+        if (group != nullptr)
+            key = ImHashData(&group->Range, sizeof(ImPlotRange), key);
+    }
+    key = ImHashData(&draw_list.Flags, sizeof(draw_list.Flags), key);
+    key = ImHashData(&draw_list._CmdHeader.ClipRect, sizeof(ImVec4), key);
+    key = ImHashData(&draw_list._CmdHeader.TextureId, sizeof(ImTextureID), key);
+    key = ImHashData(&gp.Style, sizeof(ImPlotStyle), key);
+    key = ImHashData(&gp.ColormapData.Generation, sizeof(int), key);
+    key = ImHashData(&ImGui::GetStyle(), sizeof(ImGuiStyle), key);
+    const ImFont* font = ImGui::GetFont();
+    const float font_size = ImGui::GetFontSize();
+    key = ImHashData(&font, sizeof(font), key);
+    key = ImHashData(&font_size, sizeof(float), key);
+    return key != 0 ? key : 1;
+}
+
+// Returns true if the user may be interacting with the current subplot cell, in which case it is neither replayed nor recorded
+static bool IsCellInteracting(ImPlotPlot& plot) {
+    ImGuiContext& G = *GImGui;
+    return plot.FrameRect.Contains(G.IO.MousePos) || plot.Held || plot.Selecting ||
+           AnyAxesHeld(&plot.Axes[0], ImAxis_COUNT) || G.OpenPopupStack.Size > 0 ||
+           (G.ActiveId != 0 && G.ActiveIdWindow == G.CurrentWindow);
+}
+
+// Hashes the inputs of the Setup API of the current subplot cell, which BeginPlot resets. Called at the start of SetupFinish.
+static ImGuiID CalcCellSetupKey(const ImPlotPlot& plot) {
+    ImGuiID key = ImHashData(plot.TextBuffer.Buf.Data, plot.TextBuffer.Buf.size_in_bytes(), plot.ID);
+    key = ImHashData(&plot.MouseTextLocation, sizeof(ImPlotLocation), key);
+    key = ImHashData(&plot.MouseTextFlags, sizeof(ImPlotMouseTextFlags), key);
+    for (int i = 0; i < ImAxis_COUNT; ++i) {
+        const ImPlotAxis& axis = plot.Axes[i];
+        const bool state[3] = { axis.Enabled, axis.HasFormatSpec, axis.ShowDefaultTicks };
+        key = ImHashData(state, sizeof(state), key);
+        key = ImHashData(&axis.Scale, sizeof(axis.Scale), key);
+        key = ImHashData(&axis.TransformForward, sizeof(axis.TransformForward), key);
+        key = ImHashData(&axis.TransformInverse, sizeof(axis.TransformInverse), key);
+        key = ImHashData(&axis.TransformData, sizeof(axis.TransformData), key);
+        key = ImHashData(&axis.Formatter, sizeof(axis.Formatter), key);
+        key = ImHashData(&axis.FormatterData, sizeof(axis.FormatterData), key);
+        key = ImHashData(&axis.Locator, sizeof(axis.Locator), key);
+        key = ImHashData(&axis.LabelOffset, sizeof(axis.LabelOffset), key);
+        key = ImHashData(&axis.ConstraintRange, sizeof(ImPlotRange), key);
+        key = ImHashData(&axis.ConstraintZoom, sizeof(ImPlotRange), key);
+        if (axis.HasFormatSpec)
+            key = ImHashStr(axis.FormatSpec, 0, key);
+        // custom ticks
+        for (int t = 0; t < axis.Ticker.TickCount(); ++t)
+            key = ImHashData(&axis.Ticker.Ticks[t].PlotPos, sizeof(double), key);
+        key = ImHashData(axis.Ticker.TextBuffer.Buf.Data, axis.Ticker.TextBuffer.Buf.size_in_bytes(), key);
+    }
+    return key != 0 ? key : 1;
+}
+
+// Replays the draw data of the current subplot cell and returns true if the cell is clean and its cache is valid.
+// Otherwise, starts recording the cell if possible and returns false. Called by SetupFinish, once the setup is known.
+static bool BeginCellCache(ImPlotPlot& plot) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotSubplot& subplot = *gp.CurrentSubplot;
+    ImDrawList& draw_list = *ImGui::GetWindowDrawList();
+    const int frame = ImGui::GetFrameCount();
+    const bool interacting = IsCellInteracting(plot);
+    ImPlotCellCache& cache = *gp.CellCache.GetOrAddByKey(plot.ID);
+    cache.LastFrame = frame;
+    const ImGuiID setup_key = CalcCellSetupKey(plot);
+    if (!subplot.CellDirty[subplot.CurrentIdx] && !interacting && cache.Key != 0 && cache.SetupKey == setup_key && cache.Key == CalcCellCacheKey(plot, cache.LinkGroups)) {
+        const ImTextureID font_tex = ImGui::GetIO().Fonts->TexID;
+        const ImDrawVert* vtx = cache.Vtx.Data;
+        const ImDrawIdx*  idx = cache.Idx.Data;
+        for (const ImPlotCellSegment& seg : cache.Segments) {
+            draw_list.PushClipRect(ImVec2(seg.ClipRect.x, seg.ClipRect.y), ImVec2(seg.ClipRect.z, seg.ClipRect.w));
+            draw_list.PushTextureID(seg.TextureId);
+            draw_list.PrimReserve(seg.IdxCount, seg.VtxCount);
+            const unsigned int base = draw_list._VtxCurrentIdx;
+            memcpy(draw_list._VtxWritePtr, vtx, seg.VtxCount * sizeof(ImDrawVert));
+            for (int j = 0; j < seg.IdxCount; ++j)
+                draw_list._IdxWritePtr[j] = (ImDrawIdx)(base + idx[j]);
+            draw_list._VtxWritePtr   += seg.VtxCount;
+            draw_list._IdxWritePtr   += seg.IdxCount;
+            draw_list._VtxCurrentIdx += seg.VtxCount;
+            vtx += seg.VtxCount;
+            idx += seg.IdxCount;
+            draw_list.PopTextureID();
+            draw_list.PopClipRect();
+            // keep the heatmap textures the cell references alive
+            if (seg.TextureId != font_tex) {
+                for (int i = 0; i < gp.HeatmapTextures.GetMapSize(); ++i) {
+                    ImPlotHeatmapTexture* tex = gp.HeatmapTextures.TryGetMapData(i);
+                    if (tex != nullptr && tex->Texture == seg.TextureId)
+                        tex->LastFrame = frame;
+                }
+            }
+        }
+        // contribute to the row and column alignment as the recorded plot did
+        float delta_a, delta_b;
+        if (gp.CurrentAlignmentH != nullptr)
+            gp.CurrentAlignmentH->Update(cache.PadH[0], cache.PadH[1], delta_a, delta_b);
+        if (gp.CurrentAlignmentV != nullptr)
+            gp.CurrentAlignmentV->Update(cache.PadV[0], cache.PadV[1], delta_a, delta_b);
+        subplot.CellsReplayed++;
+        GetFrameCacheStats().CellsHits++;
+        return true;
+    }
+    subplot.CellsRebuilt++;
+    GetFrameCacheStats().CellsMisses++;
+    cache.Key = 0;
+    cache.Vtx.resize(0);
+    cache.Idx.resize(0);
+    cache.Segments.resize(0);
+    // don't pay for recording cells which are dirty every frame; they are recorded once they stop changing
+    if (subplot.CellDirty[subplot.CurrentIdx]) {
+        const bool streak = cache.DirtyFrame == frame - 1;
+        cache.DirtyFrame = frame;
+        if (streak) {
+            subplot.CellDirty[subplot.CurrentIdx] = false;
+            return false;
+        }
+    }
+    if (!interacting) {
+        gp.CurrentCellCache    = &cache;
+        gp.CurrentCellCacheKey = CalcCellCacheKey(plot, nullptr);
+        gp.CurrentCellSetupKey = setup_key;
+        gp.CellCacheVtxStart   = draw_list.VtxBuffer.Size;
+        gp.CellCacheIdxStart   = draw_list.IdxBuffer.Size;
+        gp.CellCacheCmdStart   = draw_list.CmdBuffer.Size - 1;
+    }
+    return false;
+}
+
+// Stores the draw data rendered since BeginCellCache in the current cache entry, unless the plot changed the state
+// it was rendered with (e.g. fitted or linked limits) or the user started interacting with it
+static void EndCellCache(ImPlotPlot& plot) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotSubplot& subplot = *gp.CurrentSubplot;
+    ImPlotCellCache& cache = *gp.CurrentCellCache;
+    gp.CurrentCellCache = nullptr;
+    if (IsCellInteracting(plot) || CalcCellCacheKey(plot, nullptr) != gp.CurrentCellCacheKey)
+        return;
+    ImDrawList& draw_list = *ImGui::GetWindowDrawList();
+    for (int c = gp.CellCacheCmdStart; c < draw_list.CmdBuffer.Size; ++c) {
+        const ImDrawCmd& cmd = draw_list.CmdBuffer[c];
+        if (cmd.UserCallback != nullptr)
+            return;
+        const int idx_beg = ImMax((int)cmd.IdxOffset, gp.CellCacheIdxStart);
+        const int idx_end = (int)(cmd.IdxOffset + cmd.ElemCount);
+        if (idx_end <= idx_beg)
+            continue;
+        int vtx_min = INT_MAX, vtx_max = -1;
+        for (int i = idx_beg; i < idx_end; ++i) {
+            const int v = (int)(cmd.VtxOffset + draw_list.IdxBuffer.Data[i]);
+            vtx_min = ImMin(vtx_min, v);
+            vtx_max = ImMax(vtx_max, v);
+        }
+        if (vtx_min < gp.CellCacheVtxStart)
+            return;
+        ImPlotCellSegment seg;
+        seg.ClipRect  = cmd.ClipRect;
+        seg.TextureId = cmd.TextureId;
+        seg.VtxCount  = vtx_max - vtx_min + 1;
+        seg.IdxCount  = idx_end - idx_beg;
+        const int vtx_off = cache.Vtx.Size;
+        const int idx_off = cache.Idx.Size;
+        cache.Vtx.resize(vtx_off + seg.VtxCount);
+        cache.Idx.resize(idx_off + seg.IdxCount);
+        memcpy(cache.Vtx.Data + vtx_off, draw_list.VtxBuffer.Data + vtx_min, seg.VtxCount * sizeof(ImDrawVert));
+        for (int i = idx_beg; i < idx_end; ++i)
+            cache.Idx.Data[idx_off + i - idx_beg] = (ImDrawIdx)(cmd.VtxOffset + draw_list.IdxBuffer.Data[i] - vtx_min);
+        cache.Segments.push_back(seg);
+    }
+    for (int i = 0; i < ImAxis_COUNT; ++i)
+        cache.LinkGroups[i] = plot.Axes[i].LinkGroup;
+    cache.Key = CalcCellCacheKey(plot, cache.LinkGroups);
+    cache.SetupKey = gp.CurrentCellSetupKey;
+    subplot.CellDirty[subplot.CurrentIdx] = false;
+}
+
+// Redirects what the current plot draws after its cell was replayed to a scratch draw list, which is discarded by EndCellReplay
+static void BeginCellReplay() {
+    ImPlotContext& gp = *GImPlot;
+    ImGuiWindow* window = GImGui->CurrentWindow;
+    if (gp.CellScratchDrawList == nullptr)
+        gp.CellScratchDrawList = IM_NEW(ImDrawList)(ImGui::GetDrawListSharedData());
+    ImDrawList& scratch = *gp.CellScratchDrawList;
+    scratch._ResetForNewFrame();
+    scratch.Flags = window->DrawList->Flags;
+    scratch.PushTextureID(window->DrawList->_CmdHeader.TextureId);
+    scratch.PushClipRect(ImVec2(window->DrawList->_CmdHeader.ClipRect.x, window->DrawList->_CmdHeader.ClipRect.y),
+                         ImVec2(window->DrawList->_CmdHeader.ClipRect.z, window->DrawList->_CmdHeader.ClipRect.w));
+    gp.CellReplayDrawList = window->DrawList;
+    gp.CellReplayed       = true;
+    window->DrawList      = &scratch;
+}
+
+// Restores the window draw list replaced by BeginCellReplay
+static void EndCellReplay() {
+    ImPlotContext& gp = *GImPlot;
+    GImGui->CurrentWindow->DrawList = gp.CellReplayDrawList;
+    gp.CellReplayDrawList = nullptr;
+    gp.CellReplayed       = false;
+}
+
 bool BeginPlot(const char* title_id, const ImVec2& size, ImPlotFlags flags) {
     IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
     ImPlotContext& gp = *GImPlot;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot == nullptr, "Mismatched BeginPlot()/EndPlot()!");
+    const double profile_start = gp.ProfilerEnabled ? GetProfilerTime() : 0;
 
     // FRONT MATTER -----------------------------------------------------------
 
@@ -2456,6 +3104,15 @@ bool BeginPlot(const char* title_id, const ImVec2& size, ImPlotFlags flags) {
     if (gp.CurrentItems == nullptr)
         gp.CurrentItems = &plot.Items;
 
+    // start recording the plot's profile
+    gp.PlotProfile = ImPlotProfile();
+    if (gp.ProfilerEnabled) {
+        gp.PlotProfile.Frame   = ImGui::GetFrameCount();
+        gp.PlotProfileStart    = profile_start;
+        gp.PlotProfileVtxStart = Window->DrawList->VtxBuffer.Size;
+        gp.PlotProfileIdxStart = Window->DrawList->IdxBuffer.Size;
+    }
+
     return true;
 }
 
@@ -2474,6 +3131,15 @@ void SetupFinish() {
 
     ImPlotPlot &plot  = *gp.CurrentPlot;
 
+    // replay clean subplot cells (or record dirty ones), now that their setup is known
+    if (gp.CurrentSubplot != nullptr && ImHasFlag(gp.CurrentSubplot->Flags, ImPlotSubplotFlags_CacheCells) &&
+        !ImHasFlag(gp.CurrentSubplot->Flags, ImPlotSubplotFlags_ShareItems) && BeginCellCache(plot)) {
+        BeginCellReplay();
+        plot.SetupLocked = true;
+        ImGui::PushOverrideID(gp.CurrentItems->ID);
+        return;
+    }
+
     // lock setup
     plot.SetupLocked = true;
 
@@ -2568,12 +3234,16 @@ void SetupFinish() {
     const float plot_height = plot.CanvasRect.GetHeight() - pad_top - pad_bot;
 
     // (2) get y tick labels (needed for left/right pad)
+    const bool profile = gp.PlotProfile.Frame >= 0;
+    double t_locate = profile ? GetProfilerTime() : 0;
     for (int i = 0; i < IMPLOT_NUM_Y_AXES; i++) {
         ImPlotAxis& axis = plot.YAxis(i);
         if (axis.WillRender() && axis.ShowDefaultTicks && plot_height > 0) {
-            axis.Locator(axis.Ticker, axis.Range, plot_height, true, axis.Formatter, axis.FormatterData);
+            LocateTicks(axis, plot_height, true);
         }
     }
+    if (profile)
+        gp.PlotProfile.LocatorTime += GetProfilerTime() - t_locate;
 
     // (3) calc left/right pad
     PadAndDatumAxesY(plot,pad_left,pad_right,gp.CurrentAlignmentV);
@@ -2581,12 +3251,15 @@ void SetupFinish() {
     const float plot_width = plot.CanvasRect.GetWidth() - pad_left - pad_right;
 
     // (4) get x ticks
+    t_locate = profile ? GetProfilerTime() : 0;
     for (int i = 0; i < IMPLOT_NUM_X_AXES; i++) {
         ImPlotAxis& axis = plot.XAxis(i);
         if (axis.WillRender() && axis.ShowDefaultTicks && plot_width > 0) {
-            axis.Locator(axis.Ticker, axis.Range, plot_width, false, axis.Formatter, axis.FormatterData);
+            LocateTicks(axis, plot_width, false);
         }
     }
+    if (profile)
+        gp.PlotProfile.LocatorTime += GetProfilerTime() - t_locate;
 
     // (5) calc plot bb
     plot.PlotRect = ImRect(plot.CanvasRect.Min + ImVec2(pad_left, pad_top), plot.CanvasRect.Max - ImVec2(pad_right, pad_bot));
@@ -2754,9 +3427,12 @@ void SetupFinish() {
 
 
     // clear legend (TODO: put elsewhere)
-    plot.Items.Legend.Reset();
+    plot.Items.ResetLegend();
     // push ID to set item hashes (NB: !!!THIS PROBABLY NEEDS TO BE IN BEGIN PLOT!!!!)
     ImGui::PushOverrideID(gp.CurrentItems->ID);
+
+    if (profile)
+        gp.PlotProfile.SetupTime = GetProfilerTime() - gp.PlotProfileStart - gp.PlotProfile.LocatorTime;
 }
 
 //-----------------------------------------------------------------------------
@@ -2770,11 +3446,24 @@ void EndPlot() {
 
     SetupLock();
 
+    // the cell was replayed, so discard what was drawn to it since
+    if (gp.CellReplayed) {
+        EndCellReplay();
+        if (gp.CurrentItems == &gp.CurrentPlot->Items)
+            gp.CurrentItems = nullptr;
+        ImGui::PopID();
+        ResetCtxForNextPlot(GImPlot);
+        ImGui::PopID();
+        SubplotNextCell();
+        return;
+    }
+
     ImGuiContext &G       = *GImGui;
     ImPlotPlot &plot      = *gp.CurrentPlot;
     ImGuiWindow * Window  = G.CurrentWindow;
     ImDrawList & DrawList = *Window->DrawList;
     const ImGuiIO &   IO  = ImGui::GetIO();
+    const double profile_end = gp.PlotProfile.Frame >= 0 ? GetProfilerTime() : 0;
 
     // FINAL RENDER -----------------------------------------------------------
 
@@ -3145,6 +3834,10 @@ void EndPlot() {
         DrawList.AddText(pos+gp.Style.AnnotationPadding,tag.ColorFg,txt);
     }
 
+    // render profile of the last frame
+    if (gp.ProfilerOverlay && gp.PlotProfile.Frame >= 0)
+        RenderProfileOverlay(plot, DrawList);
+
     // FIT DATA --------------------------------------------------------------
     const bool axis_equal = ImHasFlag(plot.Flags, ImPlotFlags_Equal);
     if (plot.FitThisFrame) {
@@ -3234,8 +3927,11 @@ void EndPlot() {
 
     // LINKED AXES ------------------------------------------------------------
 
-    for (int i = 0; i < ImAxis_COUNT; ++i)
+    for (int i = 0; i < ImAxis_COUNT; ++i) {
         plot.Axes[i].PushLinks();
+        if (plot.Axes[i].LinkGroup != 0)
+            PushAxisLinkGroup(plot.Axes[i]);
+    }
 
 
     // CLEANUP ----------------------------------------------------------------
@@ -3250,6 +3946,19 @@ void EndPlot() {
 
     // mark the plot as initialized, i.e. having made it through one frame completely
     plot.Initialized = true;
+    // store the draw data of subplot cells
+    if (gp.CurrentCellCache != nullptr)
+        EndCellCache(plot);
+    // store the plot's profile
+    if (gp.PlotProfile.Frame >= 0) {
+        ImPlotProfile& profile = gp.PlotProfile;
+        const double t = GetProfilerTime();
+        profile.RenderTime += t - profile_end;
+        profile.TotalTime   = t - gp.PlotProfileStart;
+        profile.Vertices    = DrawList.VtxBuffer.Size - gp.PlotProfileVtxStart;
+        profile.Indices     = DrawList.IdxBuffer.Size - gp.PlotProfileIdxStart;
+        plot.Profile        = profile;
+    }
     // Pop ImGui::PushID at the end of BeginPlot
     ImGui::PopID();
     // Reset context for next plot
@@ -3390,8 +4099,25 @@ bool BeginSubplots(const char* title, int rows, int cols, const ImVec2& size, Im
         for (int c = 0; c < cols; ++c)
             subplot.ColRatios[c] = col_sizes[c] / col_sum;
     }
+    if (subplot.CellDirty.Size != rows * cols) {
+        subplot.CellDirty.resize(rows * cols);
+        SetSubplotCellDirty(-1);
+    }
     subplot.Rows = rows;
     subplot.Cols = cols;
+    // roll counters and discard the caches of cells which are no longer plotted, once per frame
+    const int frame = ImGui::GetFrameCount();
+    subplot.CellsReplayedPrev = subplot.CellsReplayed;
+    subplot.CellsRebuiltPrev  = subplot.CellsRebuilt;
+    subplot.CellsReplayed     = subplot.CellsRebuilt = 0;
+    if (gp.CellCacheFrame != frame) {
+        gp.CellCacheFrame = frame;
+        for (int i = 0; i < gp.CellCache.GetMapSize(); ++i) {
+            ImPlotCellCache* cache = gp.CellCache.TryGetMapData(i);
+            if (cache != nullptr && frame - cache->LastFrame > CELL_CACHE_MAX_IDLE_FRAMES)
+                gp.CellCache.Remove(gp.CellCache.Map.Data[i].key, cache);
+        }
+    }
 
     // calc plot frame sizes
     ImVec2 title_size(0.0f, 0.0f);
@@ -3530,12 +4256,27 @@ bool BeginSubplots(const char* title, int rows, int cols, const ImVec2& size, Im
     for (int c = 0; c < subplot.Cols; ++c)
         subplot.ColAlignmentData[c].Begin();
     // clear legend data
-    subplot.Items.Legend.Reset();
+    subplot.Items.ResetLegend();
     // Setup first subplot
     SubplotSetCell(0,0);
     return true;
 }
 
+void SetSubplotCellDirty(int idx, bool dirty) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentSubplot != nullptr, "SetSubplotCellDirty() needs to be called between BeginSubplots() and EndSubplots()!");
+    ImPlotSubplot& subplot = *gp.CurrentSubplot;
+    IM_ASSERT_USER_ERROR(idx < subplot.CellDirty.Size, "Subplot cell index out of range!");
+    if (idx < 0) {
+        for (int i = 0; i < subplot.CellDirty.Size; ++i)
+            subplot.CellDirty[i] = dirty;
+    }
+    else if (idx < subplot.CellDirty.Size) {
+        subplot.CellDirty[idx] = dirty;
+    }
+}
+
 void EndSubplots() {
     IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
     ImPlotContext& gp = *GImPlot;
@@ -3792,6 +4533,24 @@ void HideNextItem(bool hidden, ImPlotCond cond) {
     gp.NextItemData.HiddenCond = cond;
 }
 
+ImPlotItemHandle RegisterItem(const char* label_id) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "RegisterItem() needs to be called between BeginPlot() and EndPlot()!");
+    SetupLock();
+    ImPlotItemGroup& items = *gp.CurrentItems;
+    ImPlotItemHandle handle;
+    handle.ID    = items.GetItemID(label_id);
+    ImPlotItem* item = items.GetOrAddItem(handle.ID);
+    item->ID     = handle.ID;
+    handle.Index = items.GetItemIndex(item);
+    return handle;
+}
+
+void SetNextItemHandle(const ImPlotItemHandle& handle) {
+    ImPlotContext& gp = *GImPlot;
+    gp.NextItemData.Handle = handle;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Plot Tools
 //-----------------------------------------------------------------------------
@@ -4581,7 +5340,19 @@ ImU32  SampleColormapU32(float t, ImPlotColormap cmap) {
 }
 
 ImVec4 SampleColormap(float t, ImPlotColormap cmap) {
-    return ImGui::ColorConvertU32ToFloat4(SampleColormapU32(t,cmap));
+    ImPlotContext& gp = *GImPlot;
+    cmap = cmap == IMPLOT_AUTO ? gp.Style.Colormap : cmap;
+    IM_ASSERT_USER_ERROR(cmap >= 0 && cmap < gp.ColormapData.Count, "Invalid colormap index!");
+    return gp.ColormapData.LerpTableVec4(cmap, t);
+}
+
+void SetColormapTableSize(int size) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(size == 0 || size > 1, "The colormap table size must be 0 or greater than 1!");
+    if (gp.ColormapData.TableSize != size) {
+        gp.ColormapData.TableSize = size;
+        gp.ColormapData.RebuildTables();
+    }
 }
 
 void RenderColorBar(const ImU32* colors, int size, ImDrawList& DrawList, const ImRect& bounds, bool vert, bool reversed, bool continuous) {
@@ -5206,6 +5977,7 @@ void ShowAxisMetrics(const ImPlotPlot& plot, const ImPlotAxis& axis) {
     ImGui::BulletText(axis.OrthoAxis == nullptr ? "OrtherAxis: NULL" : "OrthoAxis: 0x%08X", axis.OrthoAxis->ID);
     ImGui::BulletText("LinkedMin: %p", (void*)axis.LinkedMin);
     ImGui::BulletText("LinkedMax: %p", (void*)axis.LinkedMax);
+    ImGui::BulletText("LinkGroup: 0x%08X", axis.LinkGroup);
     ImGui::BulletText("HasRange: %s", axis.HasRange ? "true" : "false");
     ImGui::BulletText("Hovered: %s", axis.Hovered ? "true" : "false");
     ImGui::BulletText("Held: %s", axis.Held ? "true" : "false");
@@ -5383,6 +6155,8 @@ void ShowMetricsWindow(bool* p_popen) {
                 }
                 ImGui::BulletText("Flags: 0x%08X", plot.Flags);
                 ImGui::BulletText("FrameHovered: %s", plot.FrameHovered ? "true" : "false");
+                if (ImHasFlag(plot.Flags, ImPlotSubplotFlags_CacheCells))
+                    ImGui::BulletText("Cells Replayed/Rebuilt: %d/%d", plot.CellsReplayedPrev, plot.CellsRebuiltPrev);
                 ImGui::BulletText("LegendHovered: %s", plot.Items.Legend.Hovered ? "true" : "false");
                 ImGui::TreePop();
             }
@@ -5390,6 +6164,101 @@ void ShowMetricsWindow(bool* p_popen) {
         }
         ImGui::TreePop();
     }
+    if (ImGui::TreeNode("Vertex Cache")) {
+        int n_vtx = 0, n_idx = 0;
+        for (int i = 0; i < gp.VertexCache.GetMapSize(); ++i) {
+            if (const ImPlotVertexCache* cache = gp.VertexCache.TryGetMapData(i)) {
+                n_vtx += cache->Vtx.Size;
+                n_idx += cache->Idx.Size;
+            }
+        }
+        ImGui::BulletText("Entries: %d", gp.VertexCache.GetAliveCount());
+        ImGui::BulletText("Memory: %d bytes", n_vtx * (int)sizeof(ImDrawVert) + n_idx * (int)sizeof(ImDrawIdx));
+        ImGui::BulletText("Hits: %d", GetCacheStats().VerticesHits);
+        ImGui::BulletText("Misses: %d", GetCacheStats().VerticesMisses);
+        if (ImGui::Button("Clear"))
+            gp.VertexCache.Clear();
+        ImGui::TreePop();
+    }
+    if (ImGui::TreeNode("Profiler")) {
+        bool enabled = gp.ProfilerEnabled, overlay = gp.ProfilerOverlay;
+        if (ImGui::Checkbox("Enabled", &enabled))
+            SetProfilerEnabled(enabled, overlay);
+        ImGui::SameLine();
+        if (ImGui::Checkbox("Overlay", &overlay))
+            SetProfilerEnabled(enabled || overlay, overlay);
+        const ImPlotCacheStats stats = GetCacheStats();
+        const char* cache_names[] = { "Extents", "Vertices", "Cells", "Ticks" };
+        const int   cache_hits[]  = { stats.ExtentsHits,   stats.VerticesHits,   stats.CellsHits,   stats.TicksHits   };
+        const int   cache_miss[]  = { stats.ExtentsMisses, stats.VerticesMisses, stats.CellsMisses, stats.TicksMisses };
+        if (ImGui::BeginTable("##Caches", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_SizingFixedFit)) {
+            ImGui::TableSetupColumn("Cache");
+            ImGui::TableSetupColumn("Hits");
+            ImGui::TableSetupColumn("Misses");
+            ImGui::TableSetupColumn("Hit Rate");
+            ImGui::TableHeadersRow();
+            for (int c = 0; c < 4; ++c) {
+                const int lookups = cache_hits[c] + cache_miss[c];
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::TextUnformatted(cache_names[c]);
+                ImGui::TableNextColumn(); ImGui::Text("%d", cache_hits[c]);
+                ImGui::TableNextColumn(); ImGui::Text("%d", cache_miss[c]);
+                ImGui::TableNextColumn();
+                if (lookups > 0)
+                    ImGui::Text("%.1f%%", 100.0 * cache_hits[c] / lookups);
+                else
+                    ImGui::TextUnformatted("-");
+            }
+            ImGui::EndTable();
+        }
+        const ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_SizingFixedFit | ImGuiTableFlags_ScrollY;
+        if (ImGui::BeginTable("##Profiles", 10, flags, ImVec2(0, ImGui::GetTextLineHeightWithSpacing() * 16))) {
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableSetupColumn("Plot/Item");
+            ImGui::TableSetupColumn("Total (ms)");
+            ImGui::TableSetupColumn("Setup");
+            ImGui::TableSetupColumn("Ticks");
+            ImGui::TableSetupColumn("Fit");
+            ImGui::TableSetupColumn("Render");
+            ImGui::TableSetupColumn("Vertices");
+            ImGui::TableSetupColumn("Indices");
+            ImGui::TableSetupColumn("Prims");
+            ImGui::TableSetupColumn("Culled");
+            ImGui::TableHeadersRow();
+            for (int p = 0; p < n_plots; ++p) {
+                ImPlotPlot& plot = *gp.Plots.GetByIndex(p);
+                if (plot.Profile.Frame < 0)
+                    continue;
+                for (int i = -1; i < plot.Items.GetItemCount(); ++i) {
+                    const ImPlotItem* item = i >= 0 ? plot.Items.GetItemByIndex(i) : nullptr;
+                    const ImPlotProfile& prof = item != nullptr ? item->Profile : plot.Profile;
+                    if (item != nullptr && prof.Frame != plot.Profile.Frame)
+                        continue;
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    if (item == nullptr)
+                        ImGui::Text("%s [0x%08X]", plot.TitleOffset != -1 ? plot.GetTitle() : "", plot.ID);
+                    else
+                        ImGui::Text("  %s", item->NameOffset >= 0 ? plot.Items.Legend.Labels.Buf.Data + item->NameOffset : "");
+                    ImGui::TableNextColumn(); ImGui::Text("%.3f", prof.TotalTime);
+                    ImGui::TableNextColumn();
+                    if (item == nullptr)
+                        ImGui::Text("%.3f", prof.SetupTime);
+                    ImGui::TableNextColumn();
+                    if (item == nullptr)
+                        ImGui::Text("%.3f", prof.LocatorTime);
+                    ImGui::TableNextColumn(); ImGui::Text("%.3f", prof.FitTime);
+                    ImGui::TableNextColumn(); ImGui::Text("%.3f", prof.RenderTime);
+                    ImGui::TableNextColumn(); ImGui::Text("%d", prof.Vertices);
+                    ImGui::TableNextColumn(); ImGui::Text("%d", prof.Indices);
+                    ImGui::TableNextColumn(); ImGui::Text("%d", prof.PrimsRendered);
+                    ImGui::TableNextColumn(); ImGui::Text("%d", prof.PrimsCulled);
+                }
+            }
+            ImGui::EndTable();
+        }
+        ImGui::TreePop();
+    }
     if (ImGui::TreeNode("Colormaps")) {
         ImGui::BulletText("Colormaps:  %d", gp.ColormapData.Count);
         ImGui::BulletText("Memory: %d bytes", gp.ColormapData.Tables.Size * 4);
@@ -160,6 +160,7 @@ enum ImPlotAxisFlags_ {
     ImPlotAxisFlags_PanStretch    = 1 << 13, // panning in a locked or constrained state will cause the axis to stretch if possible
     ImPlotAxisFlags_LockMin       = 1 << 14, // the axis minimum value will be locked when panning/zooming
     ImPlotAxisFlags_LockMax       = 1 << 15, // the axis maximum value will be locked when panning/zooming
+    ImPlotAxisFlags_NoTickCache   = 1 << 16, // tick labels will be regenerated every frame instead of reused while the axis range, size, format and font are unchanged
     ImPlotAxisFlags_Lock          = ImPlotAxisFlags_LockMin | ImPlotAxisFlags_LockMax,
     ImPlotAxisFlags_NoDecorations = ImPlotAxisFlags_NoLabel | ImPlotAxisFlags_NoGridLines | ImPlotAxisFlags_NoTickMarks | ImPlotAxisFlags_NoTickLabels,
     ImPlotAxisFlags_AuxDefault    = ImPlotAxisFlags_NoGridLines | ImPlotAxisFlags_Opposite
@@ -178,7 +179,8 @@ enum ImPlotSubplotFlags_ {
     ImPlotSubplotFlags_LinkCols    = 1 << 7,  // link the x-axis limits of all plots in each column (does not apply to auxiliary axes)
     ImPlotSubplotFlags_LinkAllX    = 1 << 8,  // link the x-axis limits in every plot in the subplot (does not apply to auxiliary axes)
     ImPlotSubplotFlags_LinkAllY    = 1 << 9,  // link the y-axis limits in every plot in the subplot (does not apply to auxiliary axes)
-    ImPlotSubplotFlags_ColMajor    = 1 << 10  // subplots are added in column major order instead of the default row major order
+    ImPlotSubplotFlags_ColMajor    = 1 << 10, // subplots are added in column major order instead of the default row major order
+    ImPlotSubplotFlags_CacheCells  = 1 << 11  // clean cells replay their last draw data instead of being rebuilt (see SetSubplotCellDirty; not applicable with ImPlotSubplotFlags_ShareItems)
 };
 
 // Options for legends (see SetupLegend)
@@ -220,9 +222,13 @@ enum ImPlotColormapScaleFlags_ {
 
 // Flags for ANY PlotX function
 enum ImPlotItemFlags_ {
-    ImPlotItemFlags_None     = 0,
-    ImPlotItemFlags_NoLegend = 1 << 0, // the item won't have a legend entry displayed
-    ImPlotItemFlags_NoFit    = 1 << 1, // the item won't be considered for plot fits
+    ImPlotItemFlags_None          = 0,
+    ImPlotItemFlags_NoLegend      = 1 << 0, // the item won't have a legend entry displayed
+    ImPlotItemFlags_NoFit         = 1 << 1, // the item won't be considered for plot fits
+    ImPlotItemFlags_SortedX       = 1 << 2, // the item's x data is sorted in ascending order, so only the visible range of it will be processed when rendering
+    ImPlotItemFlags_CacheExtents  = 1 << 3, // the extents of the item's data buffers will be cached between frames; call InvalidateDataCache after modifying them
+    ImPlotItemFlags_CacheVertices = 1 << 4, // the item's vertices will be reused while its data pointers, arguments, style, and axes are unchanged; call InvalidateDataCache after modifying its data
+    ImPlotItemFlags_SpatialIndex  = 1 << 5, // the item's points will be indexed for QueryNearestPoint (lines, scatters, and stairs only, without an offset or ring buffer); appended points are indexed incrementally; call InvalidateDataCache after modifying its data
 };
 
 // Flags for PlotLine
@@ -233,12 +239,14 @@ enum ImPlotLineFlags_ {
     ImPlotLineFlags_SkipNaN     = 1 << 12, // NaNs values will be skipped instead of rendered as missing data
     ImPlotLineFlags_NoClip      = 1 << 13, // markers (if displayed) on the edge of a plot will not be clipped
     ImPlotLineFlags_Shaded      = 1 << 14, // a filled region between the line and horizontal origin will be rendered; use PlotShaded for more advanced cases
+    ImPlotLineFlags_Downsample  = 1 << 15, // only the first, min, max, and last point of each pixel column will be rendered; x data must be sorted in ascending order
 };
 
 // Flags for PlotScatter
 enum ImPlotScatterFlags_ {
-    ImPlotScatterFlags_None   = 0,       // default
-    ImPlotScatterFlags_NoClip = 1 << 10, // markers on the edge of a plot will not be clipped
+    ImPlotScatterFlags_None    = 0,       // default
+    ImPlotScatterFlags_NoClip  = 1 << 10, // markers on the edge of a plot will not be clipped
+    ImPlotScatterFlags_Density = 1 << 11, // instead of markers, the number of points in each pixel of the plot will be rendered with the current colormap (log scaled); use when points greatly outnumber pixels
 };
 
 // Flags for PlotStairs
@@ -248,9 +256,10 @@ enum ImPlotStairsFlags_ {
     ImPlotStairsFlags_Shaded   = 1 << 11  // a filled region between the stairs and horizontal origin will be rendered; use PlotShaded for more advanced cases
 };
 
-// Flags for PlotShaded (placeholder)
+// Flags for PlotShaded
 enum ImPlotShadedFlags_ {
-    ImPlotShadedFlags_None  = 0 // default
+    ImPlotShadedFlags_None       = 0,      // default
+    ImPlotShadedFlags_Downsample = 1 << 10 // only the lowest and highest value of each pixel column will be rendered; x data must be sorted in ascending order
 };
 
 // Flags for PlotBars
@@ -295,6 +304,7 @@ enum ImPlotPieChartFlags_ {
 enum ImPlotHeatmapFlags_ {
     ImPlotHeatmapFlags_None     = 0,       // default
     ImPlotHeatmapFlags_ColMajor = 1 << 10, // data will be read in column major order
+    ImPlotHeatmapFlags_Texture  = 1 << 11, // values will be colored into a texture rendered as a single image; requires SetTextureCallbacks and linear axes, and re-uploads only when the data pointer, dimensions, scale or colormap change (call InvalidateDataCache after modifying the data)
 };
 
 // Flags for PlotHistogram and PlotHistogram2D
@@ -307,9 +317,10 @@ enum ImPlotHistogramFlags_ {
     ImPlotHistogramFlags_ColMajor   = 1 << 14  // data will be read in column major order (not supported by PlotHistogram)
 };
 
-// Flags for PlotDigital (placeholder)
+// Flags for PlotDigital and PlotDigitalEdges
 enum ImPlotDigitalFlags_ {
-    ImPlotDigitalFlags_None = 0 // default
+    ImPlotDigitalFlags_None        = 0,      // default
+    ImPlotDigitalFlags_Transitions = 1 << 10 // the indices where the value changes are found once and cached (call InvalidateDataCache after modifying the data), and only the runs in the visible x range are rendered (x values must be ascending)
 };
 
 // Flags for PlotImage (placeholder)
@@ -503,6 +514,37 @@ struct ImPlotRect {
     ImPlotPoint Max() const                                                      { return ImPlotPoint(X.Max, Y.Max);          }
 };
 
+// Handle to a plot item, which can be kept across frames to plot the item without looking it up by label (see RegisterItem).
+struct ImPlotItemHandle {
+    ImGuiID ID;     // ID of the item's label
+    int     Index;  // index of the item in its plot
+    constexpr ImPlotItemHandle() : ID(0), Index(-1) { }
+};
+
+// CPU time and geometry of a plot or item in one frame, recorded while the profiler is enabled (see SetProfilerEnabled).
+struct ImPlotProfile {
+    double SetupTime;      // ms spent in BeginPlot, the Setup API and SetupFinish, excluding LocatorTime (plots only)
+    double LocatorTime;    // ms spent locating and formatting axis ticks (plots only)
+    double FitTime;        // ms spent fitting axes to item data
+    double RenderTime;     // ms spent rendering items, and for plots also in EndPlot
+    double TotalTime;      // ms from BeginPlot to the end of EndPlot (or BeginItem to EndItem), including user code in between
+    int    Vertices;       // vertices added to the draw list
+    int    Indices;        // indices added to the draw list
+    int    PrimsRendered;  // primitives (segments, markers, rects, ...) added by item renderers
+    int    PrimsCulled;    // primitives skipped by item renderers because they were outside of the plot area
+    int    Frame;          // frame the profile was recorded in, or -1 if it never was
+    ImPlotProfile() { SetupTime = LocatorTime = FitTime = RenderTime = TotalTime = 0; Vertices = Indices = PrimsRendered = PrimsCulled = 0; Frame = -1; }
+};
+
+// Hits and misses of ImPlot's caches in one frame (see GetCacheStats).
+struct ImPlotCacheStats {
+    int ExtentsHits,  ExtentsMisses;   // data extents of fitted buffers (see ImPlotItemFlags_CacheExtents)
+    int VerticesHits, VerticesMisses;  // retained item vertices (see ImPlotItemFlags_CacheVertices)
+    int CellsHits,    CellsMisses;     // retained subplot cells (see ImPlotSubplotFlags_CacheCells)
+    int TicksHits,    TicksMisses;     // axis ticks and labels (see ImPlotAxisFlags_NoTickCache)
+    ImPlotCacheStats() { ExtentsHits = ExtentsMisses = VerticesHits = VerticesMisses = CellsHits = CellsMisses = TicksHits = TicksMisses = 0; }
+};
+
 // Plot style structure
 struct ImPlotStyle {
     // item styling variables
@@ -587,9 +629,22 @@ typedef int (*ImPlotFormatter)(double value, char* buff, int size, void* user_da
 // Callback signature for data getter.
 typedef ImPlotPoint (*ImPlotGetter)(int idx, void* user_data);
 
+// Callback signature for batched data getter. Must fill #points with the #count points starting at index #idx.
+typedef void (*ImPlotBatchGetter)(int idx, int count, ImPlotPoint* points, void* user_data);
+
 // Callback signature for axis transform.
 typedef double (*ImPlotTransform)(double value, void* user_data);
 
+// Callback signature for parallel job execution. Must call job(i, job_data) for every i in [0,count) and return once all calls have finished.
+typedef void (*ImPlotParallelFor)(int count, void (*job)(int idx, void* job_data), void* job_data, void* user_data);
+
+// Callback signature for creating or updating an RGBA32 texture of #width x #height pixels. #tex is 0 to create a new texture.
+// Returns the texture, which may differ from #tex, or 0 on failure.
+typedef ImTextureID (*ImPlotTextureUpdate)(ImTextureID tex, int width, int height, const void* pixels, void* user_data);
+
+// Callback signature for destroying a texture created by an ImPlotTextureUpdate callback.
+typedef void (*ImPlotTextureDestroy)(ImTextureID tex, void* user_data);
+
 namespace ImPlot {
 
 //-----------------------------------------------------------------------------
@@ -611,6 +666,25 @@ IMPLOT_API void SetCurrentContext(ImPlotContext* ctx);
 // See GImGui documentation in imgui.cpp for more details.
 IMPLOT_API void SetImGuiContext(ImGuiContext* ctx);
 
+// Sets a callback which ImPlot uses to generate vertices for very large items on multiple threads (e.g. with your own thread pool).
+// Items with #min_prims or more primitives are split into chunks which are rendered by the callback's jobs, and histograms of as many values are binned in
+// parallel. nullptr = single threaded (default).
+// Requires a backend that sets ImGuiBackendFlags_RendererHasVtxOffset. Custom getters and axis transforms used with large items must be thread-safe.
+IMPLOT_API void SetParallelFor(ImPlotParallelFor callback, void* user_data = nullptr, int min_prims = 1000000);
+
+// Sets the callbacks which ImPlot uses to manage the textures of heatmaps plotted with ImPlotHeatmapFlags_Texture (e.g.
+// ImGui_ImplOpenGL3_UpdateTexture/DestroyTexture of the bundled OpenGL3 backend). nullptr = heatmaps are rendered as quads (default).
+// Textures are destroyed when their item is no longer plotted, and by DestroyContext.
+IMPLOT_API void SetTextureCallbacks(ImPlotTextureUpdate update, ImPlotTextureDestroy destroy, void* user_data = nullptr);
+
+// Opts a context (nullptr = current) into rendering small markers as pre-rasterized sprites, which are baked into #atlas when it is next built.
+// #atlas must not have been built yet and must be the font atlas of the ImGui context the plots are drawn with. Does nothing if another context
+// already registered its sprites with the atlas. Call RemoveFontAtlasMarkerSprites (or DestroyContext) while that ImGui context is current
+// to restore the atlas' previous font builder; otherwise the builder is restored when the atlas is next built.
+IMPLOT_API void AddFontAtlasMarkerSprites(ImFontAtlas* atlas, ImPlotContext* ctx = nullptr);
+// Stops rendering markers as sprites and restores the font builder of the atlas given marker sprites by a context (nullptr = current).
+IMPLOT_API void RemoveFontAtlasMarkerSprites(ImPlotContext* ctx = nullptr);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Begin/End Plot
 //-----------------------------------------------------------------------------
@@ -686,6 +760,9 @@ IMPLOT_API void EndPlot();
 // - The #size parameter of _BeginPlot_ (see above) is ignored when inside of a
 //   subplot context. The actual size of the subplot will be based on the
 //   #size value you pass to _BeginSubplots_ and #row/#col_ratios if provided.
+// - With ImPlotSubplotFlags_CacheCells, clean cells replay their draw data once
+//   their setup is finished. Their items then return without rendering, so
+//   call the Setup API and EndPlot as usual.
 
 IMPLOT_API bool BeginSubplots(const char* title_id,
                              int rows,
@@ -699,6 +776,14 @@ IMPLOT_API bool BeginSubplots(const char* title_id,
 // of an if statement conditioned on BeginSublots(). See example above.
 IMPLOT_API void EndSubplots();
 
+// Marks cell #idx of the current subplot dirty or clean, or every cell if #idx < 0. Only applicable with
+// ImPlotSubplotFlags_CacheCells: when its setup is finished, a clean cell replays the draw data it rendered when it
+// was last rebuilt and skips its items, unless its size, limits, links, alignment, style or Setup API inputs (labels,
+// scales, formatters, locators, ticks) changed, or the user is interacting with it. Cells start dirty and become
+// clean once rebuilt, so mark a cell dirty whenever its data changes. Must be called between BeginSubplots and the
+// cell's BeginPlot.
+IMPLOT_API void SetSubplotCellDirty(int idx = -1, bool dirty = true);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Setup
 //-----------------------------------------------------------------------------
@@ -734,9 +819,12 @@ IMPLOT_API void SetupAxis(ImAxis axis, const char* label=nullptr, ImPlotAxisFlag
 IMPLOT_API void SetupAxisLimits(ImAxis axis, double v_min, double v_max, ImPlotCond cond = ImPlotCond_Once);
 // Links an axis range limits to external values. Set to nullptr for no linkage. The pointer data must remain valid until EndPlot.
 IMPLOT_API void SetupAxisLinks(ImAxis axis, double* link_min, double* link_max);
+// Makes an axis a member of an axis link group (see CreateAxisLinkGroup).
+IMPLOT_API void SetupAxisLinkGroup(ImAxis axis, ImGuiID group);
 // Sets the format of numeric axis labels via formater specifier (default="%g"). Formated values will be double (i.e. use %f).
 IMPLOT_API void SetupAxisFormat(ImAxis axis, const char* fmt);
 // Sets the format of numeric axis labels via formatter callback. Given #value, write a label into #buff. Optionally pass user data.
+// Labels are cached per value; if the callback's output can change for the same #value (e.g. it reads mutable state via #data), set ImPlotAxisFlags_NoTickCache.
 IMPLOT_API void SetupAxisFormat(ImAxis axis, ImPlotFormatter formatter, void* data=nullptr);
 // Sets an axis' ticks and optionally the labels. To keep the default ticks, set #keep_default=true.
 IMPLOT_API void SetupAxisTicks(ImAxis axis, const double* values, int n_ticks, const char* const labels[]=nullptr, bool keep_default=false);
@@ -800,6 +888,16 @@ IMPLOT_API void SetNextAxesLimits(double x_min, double x_max, double y_min, doub
 // Sets all upcoming axes to auto fit to their data.
 IMPLOT_API void SetNextAxesToFit();
 
+// Creates an axis link group with initial limits, or returns the existing group with the same #label_id. Axes that join
+// the group with SetupAxisLinkGroup share its limits. Limit changes made by a member (e.g. panning or fitting it) are
+// applied to the other members at the start of the next frame, so they lag the changed member by one frame. Members
+// with the same size and format share one tick computation and label layout.
+IMPLOT_API ImGuiID CreateAxisLinkGroup(const char* label_id, double v_min = 0, double v_max = 1);
+// Gets the limits of an axis link group in the current frame.
+IMPLOT_API ImPlotRange GetAxisLinkGroupLimits(ImGuiID group);
+// Sets the limits of an axis link group. Call before the group's plots to apply them in the current frame.
+IMPLOT_API void SetAxisLinkGroupLimits(ImGuiID group, double v_min, double v_max);
+
 //-----------------------------------------------------------------------------
 // [SECTION] Plot Items
 //-----------------------------------------------------------------------------
@@ -856,22 +954,35 @@ IMPLOT_API void SetNextAxesToFit();
 IMPLOT_TMP void PlotLine(const char* label_id, const T* values, int count, double xscale=1, double xstart=0, ImPlotLineFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_TMP void PlotLine(const char* label_id, const T* xs, const T* ys, int count, ImPlotLineFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_API void PlotLineG(const char* label_id, ImPlotGetter getter, void* data, int count, ImPlotLineFlags flags=0);
+IMPLOT_API void PlotLineG(const char* label_id, ImPlotBatchGetter getter, void* data, int count, ImPlotLineFlags flags=0);
 
 // Plots a standard 2D scatter plot. Default marker is ImPlotMarker_Circle.
 IMPLOT_TMP void PlotScatter(const char* label_id, const T* values, int count, double xscale=1, double xstart=0, ImPlotScatterFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_TMP void PlotScatter(const char* label_id, const T* xs, const T* ys, int count, ImPlotScatterFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_API void PlotScatterG(const char* label_id, ImPlotGetter getter, void* data, int count, ImPlotScatterFlags flags=0);
+IMPLOT_API void PlotScatterG(const char* label_id, ImPlotBatchGetter getter, void* data, int count, ImPlotScatterFlags flags=0);
 
 // Plots a a stairstep graph. The y value is continued constantly to the right from every x position, i.e. the interval [x[i], x[i+1]) has the value y[i]
 IMPLOT_TMP void PlotStairs(const char* label_id, const T* values, int count, double xscale=1, double xstart=0, ImPlotStairsFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_TMP void PlotStairs(const char* label_id, const T* xs, const T* ys, int count, ImPlotStairsFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_API void PlotStairsG(const char* label_id, ImPlotGetter getter, void* data, int count, ImPlotStairsFlags flags=0);
+IMPLOT_API void PlotStairsG(const char* label_id, ImPlotBatchGetter getter, void* data, int count, ImPlotStairsFlags flags=0);
 
 // Plots a shaded (filled) region between two lines, or a line and a horizontal reference. Set yref to +/-INFINITY for infinite fill extents.
 IMPLOT_TMP void PlotShaded(const char* label_id, const T* values, int count, double yref=0, double xscale=1, double xstart=0, ImPlotShadedFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_TMP void PlotShaded(const char* label_id, const T* xs, const T* ys, int count, double yref=0, ImPlotShadedFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_TMP void PlotShaded(const char* label_id, const T* xs, const T* ys1, const T* ys2, int count, ImPlotShadedFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_API void PlotShadedG(const char* label_id, ImPlotGetter getter1, void* data1, ImPlotGetter getter2, void* data2, int count, ImPlotShadedFlags flags=0);
+IMPLOT_API void PlotShadedG(const char* label_id, ImPlotBatchGetter getter1, void* data1, ImPlotBatchGetter getter2, void* data2, int count, ImPlotShadedFlags flags=0);
+
+// Plots a line, scatter, stairs, or shaded region from ring buffers (e.g. scrolling telemetry) of #capacity values, holding #size values from the oldest one at
+// index #head. The buffers are read as two contiguous spans rather than wrapping every index, and only their visible range is rendered with ImPlotItemFlags_SortedX
+// if x ascends from the oldest to the newest value (e.g. time).
+IMPLOT_TMP void PlotLineRing(const char* label_id, const T* xs, const T* ys, int capacity, int head, int size, ImPlotLineFlags flags=0, int stride=sizeof(T));
+IMPLOT_TMP void PlotScatterRing(const char* label_id, const T* xs, const T* ys, int capacity, int head, int size, ImPlotScatterFlags flags=0, int stride=sizeof(T));
+IMPLOT_TMP void PlotStairsRing(const char* label_id, const T* xs, const T* ys, int capacity, int head, int size, ImPlotStairsFlags flags=0, int stride=sizeof(T));
+IMPLOT_TMP void PlotShadedRing(const char* label_id, const T* xs, const T* ys, int capacity, int head, int size, double yref=0, ImPlotShadedFlags flags=0, int stride=sizeof(T));
+IMPLOT_TMP void PlotShadedRing(const char* label_id, const T* xs, const T* ys1, const T* ys2, int capacity, int head, int size, ImPlotShadedFlags flags=0, int stride=sizeof(T));
 
 // Plots a bar graph. Vertical by default. #bar_size and #shift are in plot units.
 IMPLOT_TMP void PlotBars(const char* label_id, const T* values, int count, double bar_size=0.67, double shift=0, ImPlotBarsFlags flags=0, int offset=0, int stride=sizeof(T));
@@ -907,10 +1018,26 @@ IMPLOT_TMP double PlotHistogram(const char* label_id, const T* values, int count
 // #xs an #ys will be used as the ranges. Otherwise, outlier values outside of range are not binned. The largest bin count or density is returned.
 IMPLOT_TMP double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count, int x_bins=ImPlotBin_Sturges, int y_bins=ImPlotBin_Sturges, ImPlotRect range=ImPlotRect(), ImPlotHistogramFlags flags=0);
 
+// Computes the bins of a histogram without plotting them, e.g. once when the data changes, to be plotted later with PlotBars. #bin_counts must hold #bins (> 0)
+// elements, bin b spanning range.Min + [b, b+1] * range.Size() / #bins. #range and #flags are as in PlotHistogram. The largest bin count or density is returned.
+// Large inputs are binned with #parallel_for, if not nullptr. Does not use the current context, so it is safe to call from any thread (e.g. a worker thread).
+IMPLOT_TMP double ComputeHistogram(const T* values, int count, double* bin_counts, int bins, ImPlotRange range=ImPlotRange(), ImPlotHistogramFlags flags=0, ImPlotParallelFor parallel_for=nullptr, void* parallel_data=nullptr);
+
+// Computes the bins of a bivariate histogram without plotting them, to be plotted later with PlotHeatmap. #bin_counts must hold #x_bins * #y_bins (> 0) elements,
+// stored row major from the top of #range down, as PlotHeatmap expects. #range and #flags are as in PlotHistogram2D; with ImPlotHistogramFlags_ColMajor, plot them
+// with ImPlotHeatmapFlags_ColMajor to get the same cells as PlotHistogram2D. The largest bin count or density is returned.
+// Large inputs are binned with #parallel_for, if not nullptr. Does not use the current context, so it is safe to call from any thread (e.g. a worker thread).
+IMPLOT_TMP double ComputeHistogram2D(const T* xs, const T* ys, int count, double* bin_counts, int x_bins, int y_bins, ImPlotRect range=ImPlotRect(), ImPlotHistogramFlags flags=0, ImPlotParallelFor parallel_for=nullptr, void* parallel_data=nullptr);
+
 // Plots digital data. Digital plots do not respond to y drag or zoom, and are always referenced to the bottom of the plot.
 IMPLOT_TMP void PlotDigital(const char* label_id, const T* xs, const T* ys, int count, ImPlotDigitalFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_API void PlotDigitalG(const char* label_id, ImPlotGetter getter, void* data, int count, ImPlotDigitalFlags flags=0);
 
+// Plots digital data given as a list of value changes: the value #ys[i] holds from #xs[i] until #xs[i+1], and the last one until #x_end. #xs must be ascending.
+// Only the changes in the visible x range are rendered, so long captures can be plotted at a cost that scales with their edges rather than their samples.
+// The largest value, which sets the channel height, is cached and updated as edges are appended; call InvalidateDataCache after modifying #ys in place.
+IMPLOT_TMP void PlotDigitalEdges(const char* label_id, const T* xs, const T* ys, int count, double x_end, ImPlotDigitalFlags flags=0, int offset=0, int stride=sizeof(T));
+
 // Plots an axis-aligned image. #bounds_min/bounds_max are in plot coordinates (y-up) and #uv0/uv1 are in texture coordinates (y-down).
 IMPLOT_API void PlotImage(const char* label_id, ImTextureID user_texture_id, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, const ImVec2& uv0=ImVec2(0,0), const ImVec2& uv1=ImVec2(1,1), const ImVec4& tint_col=ImVec4(1,1,1,1), ImPlotImageFlags flags=0);
 
@@ -979,6 +1106,10 @@ IMPLOT_API ImVec2 GetPlotSize();
 IMPLOT_API ImPlotPoint GetPlotMousePos(ImAxis x_axis = IMPLOT_AUTO, ImAxis y_axis = IMPLOT_AUTO);
 // Returns the current plot axis range.
 IMPLOT_API ImPlotRect GetPlotLimits(ImAxis x_axis = IMPLOT_AUTO, ImAxis y_axis = IMPLOT_AUTO);
+// Returns the index of the point of an item plotted with ImPlotItemFlags_SpatialIndex that is nearest to the mouse and
+// within #radius_px pixels of it, or -1 if there is none. Items plotted with a nonzero #offset or from a ring buffer are
+// not indexed, so -1 is always returned for them. Optionally returns the point in plot coordinates. Call after plotting the item.
+IMPLOT_API int QueryNearestPoint(const char* label_id, float radius_px = 10, ImPlotPoint* point = nullptr);
 
 // Returns true if the plot area in the current plot is hovered.
 IMPLOT_API bool IsPlotHovered();
@@ -998,6 +1129,22 @@ IMPLOT_API void CancelPlotSelection();
 // Use ImPlotCond_Always if you need to forcefully set this every frame.
 IMPLOT_API void HideNextItem(bool hidden = true, ImPlotCond cond = ImPlotCond_Once);
 
+// Registers an item of the current plot (if needed) and returns a handle to it. Store the handle and pass it to
+// SetNextItemHandle before plotting the item in later frames, so that it is found without hashing its label. The label
+// must still be passed to the PlotX function; it is only copied to the legend again when it changes. Handles
+// remain valid until the plot's items are reset (e.g. by BustItemCache), after which items are looked up by label.
+IMPLOT_API ImPlotItemHandle RegisterItem(const char* label_id);
+// Identifies the next item by a handle returned by RegisterItem instead of by its label.
+IMPLOT_API void SetNextItemHandle(const ImPlotItemHandle& handle);
+
+// Invalidates the extents cached for the data buffer #data by items plotted with ImPlotItemFlags_CacheExtents, and the
+// vertices of items plotted from it with ImPlotItemFlags_CacheVertices, the textures of heatmaps plotted from it with
+// ImPlotHeatmapFlags_Texture, the run indices of digital signals plotted from it with ImPlotDigitalFlags_Transitions or PlotDigitalEdges, and
+// the spatial indices of items plotted from it with ImPlotItemFlags_SpatialIndex (for PlotXG functions, #data is the
+// getter's data pointer). Call this after modifying a cached buffer in place.
+// If #data is nullptr, the entire cache is cleared.
+IMPLOT_API void InvalidateDataCache(const void* data = nullptr);
+
 // Use the following around calls to Begin/EndPlot to align l/r/t/b padding.
 // Consider using Begin/EndSubplots first. They are more feature rich and
 // accomplish the same behaviour by default. The functions below offer lower
@@ -1149,7 +1296,8 @@ IMPLOT_API const char* GetMarkerName(ImPlotMarker idx);
 // string name with PushColormap. The colormap name must be unique and the size must be greater than 1. You will receive
 // an assert otherwise! By default colormaps are considered to be qualitative (i.e. discrete). If you want to create a
 // continuous colormap, set #qual=false. This will treat the colors you provide as keys, and ImPlot will build a linearly
-// interpolated lookup table. The memory footprint of this table will be exactly ((size-1)*255+1)*4 bytes.
+// interpolated lookup table. The memory footprint of this table will be exactly ((size-1)*255+1)*4 bytes,
+// unless a table size has been set with SetColormapTableSize.
 IMPLOT_API ImPlotColormap AddColormap(const char* name, const ImVec4* cols, int size, bool qual=true);
 IMPLOT_API ImPlotColormap AddColormap(const char* name, const ImU32*  cols, int size, bool qual=true);
 
@@ -1180,6 +1328,11 @@ IMPLOT_API int GetColormapSize(ImPlotColormap cmap = IMPLOT_AUTO);
 IMPLOT_API ImVec4 GetColormapColor(int idx, ImPlotColormap cmap = IMPLOT_AUTO);
 // Sample a color from the current colormap given t between 0 and 1.
 IMPLOT_API ImVec4 SampleColormap(float t, ImPlotColormap cmap = IMPLOT_AUTO);
+// Maps #count values to colors, exactly as heatmaps do: each value is remapped from [scale_min,scale_max] to [0,1], clamped,
+// and sampled from the colormap (NaNs sample 0). Vectorized for float, double, ImS32, ImU16 and ImU8 values.
+IMPLOT_TMP void ColormapMapValues(const T* values, int count, double scale_min, double scale_max, ImU32* out, ImPlotColormap cmap = IMPLOT_AUTO);
+// Sets the number of entries in the lookup tables of continuous colormaps (e.g. 4096), or 0 (default) for 255 entries per pair of keys.
+IMPLOT_API void SetColormapTableSize(int size);
 
 // Shows a vertical color scale with linear spaced ticks using the specified color map. Use double hashes to hide label (e.g. "##NoLabel"). If scale_min > scale_max, the scale to color mapping will be reversed.
 IMPLOT_API void ColormapScale(const char* label, double scale_min, double scale_max, const ImVec2& size = ImVec2(0,0), const char* format = "%g", ImPlotColormapScaleFlags flags = 0, ImPlotColormap cmap = IMPLOT_AUTO);
@@ -1238,6 +1391,20 @@ IMPLOT_API void ShowUserGuide();
 // Shows ImPlot metrics/debug information window.
 IMPLOT_API void ShowMetricsWindow(bool* p_popen = nullptr);
 
+// Enables or disables the profiler, which records the CPU time and geometry of every plot and item (see ImPlotProfile).
+// If #overlay is true, each plot also displays its profile of the previous frame. The profiler is disabled by default.
+IMPLOT_API void SetProfilerEnabled(bool enabled, bool overlay = false);
+// Returns true if the profiler is enabled.
+IMPLOT_API bool IsProfilerEnabled();
+// Gets the last recorded profile of a plot. Returns false if the plot doesn't exist or was never profiled.
+// This function must be called in the same ImGui ID scope that the plot is in.
+IMPLOT_API bool GetPlotProfile(const char* plot_title_id, ImPlotProfile* profile);
+// Gets the last recorded profile of an item of a plot, summed over the times it was plotted in that frame. Returns false
+// if the item doesn't exist or was never profiled. This function must be called in the same ImGui ID scope that the plot is in.
+IMPLOT_API bool GetItemProfile(const char* plot_title_id, const char* label_id, ImPlotProfile* profile);
+// Gets the hits and misses of ImPlot's caches in the previous frame. These are counted whether or not the profiler is enabled.
+IMPLOT_API ImPlotCacheStats GetCacheStats();
+
 //-----------------------------------------------------------------------------
 // [SECTION] Demo
 //-----------------------------------------------------------------------------
@@ -70,6 +70,11 @@ void PlotCandlestick(const char* label_id, const double* xs, const double* opens
 // Example for Custom Styles section.
 void StyleSeaborn();
 
+// Example for Benchmarks section.
+void BenchmarkArrayStats();
+void BenchmarkTimeAxis();
+void BenchmarkShaded();
+
 } // namespace MyImPlot
 
 namespace ImPlot {
@@ -668,6 +673,11 @@ void Demo_Heatmaps() {
     static ImPlotHeatmapFlags hm_flags = 0;
 
     ImGui::CheckboxFlags("Column Major", (unsigned int*)&hm_flags, ImPlotHeatmapFlags_ColMajor);
+    ImGui::SameLine();
+    // Continuous colormaps use 255 colors between each pair of keys by default. Larger tables give smoother gradients.
+    static bool hires = false;
+    if (ImGui::Checkbox("4096 Color Tables", &hires))
+        ImPlot::SetColormapTableSize(hires ? 4096 : 0);
 
     static ImPlotAxisFlags axes_flags = ImPlotAxisFlags_Lock | ImPlotAxisFlags_NoGridLines | ImPlotAxisFlags_NoTickMarks;
 
@@ -899,8 +909,8 @@ void Demo_RealtimePlots() {
         ImPlot::SetupAxisLimits(ImAxis_X1,t - history, t, ImGuiCond_Always);
         ImPlot::SetupAxisLimits(ImAxis_Y1,0,1);
         ImPlot::SetNextFillStyle(IMPLOT_AUTO_COL,0.5f);
-        ImPlot::PlotShaded("Mouse X", &sdata1.Data[0].x, &sdata1.Data[0].y, sdata1.Data.size(), -INFINITY, 0, sdata1.Offset, 2 * sizeof(float));
-        ImPlot::PlotLine("Mouse Y", &sdata2.Data[0].x, &sdata2.Data[0].y, sdata2.Data.size(), 0, sdata2.Offset, 2*sizeof(float));
+        ImPlot::PlotShadedRing("Mouse X", &sdata1.Data[0].x, &sdata1.Data[0].y, sdata1.MaxSize, sdata1.Offset, sdata1.Data.size(), -INFINITY, ImPlotItemFlags_SortedX, 2 * sizeof(float));
+        ImPlot::PlotLineRing("Mouse Y", &sdata2.Data[0].x, &sdata2.Data[0].y, sdata2.MaxSize, sdata2.Offset, sdata2.Data.size(), ImPlotItemFlags_SortedX, 2*sizeof(float));
         ImPlot::EndPlot();
     }
     if (ImPlot::BeginPlot("##Rolling", ImVec2(-1,150))) {
@@ -1180,6 +1190,34 @@ void Demo_LinkedAxes() {
         }
         ImPlot::EndAlignedPlots();
     }
+
+    ImGui::BulletText("Link groups share limits and tick layout between many plots.");
+    ImGui::BulletText("Members of different widths need their own tick layouts, which are cached as well.");
+    static const double t0 = 1609459200; // 01/01/2021
+    const ImGuiID time_group = ImPlot::CreateAxisLinkGroup("##TimeGroup", t0, t0 + 86400);
+    if (ImGui::Button("Reset Time Range"))
+        ImPlot::SetAxisLinkGroupLimits(time_group, t0, t0 + 86400);
+    const ImPlotCacheStats stats = ImPlot::GetCacheStats();
+    ImGui::SameLine();
+    ImGui::Text("Tick cache (last frame): %d hits, %d misses", stats.TicksHits, stats.TicksMisses);
+    static double values[6][97];
+    static double times[97];
+    for (int i = 0; i < 97; ++i) {
+        times[i] = t0 + i * 900;
+        for (int p = 0; p < 6; ++p)
+            values[p][i] = 0.5 + 0.4 * sin(i * 0.1 * (p + 1));
+    }
+    for (int p = 0; p < 6; ++p) {
+        ImGui::PushID(p);
+        if (ImPlot::BeginPlot("##Grouped", ImVec2(-1 - 60.0f * p, 100))) {
+            ImPlot::SetupAxisScale(ImAxis_X1, ImPlotScale_Time);
+            ImPlot::SetupAxisLinkGroup(ImAxis_X1, time_group);
+            ImPlot::SetupAxisLimits(ImAxis_Y1, 0, 1);
+            ImPlot::PlotLine("Signal", times, values[p], 97);
+            ImPlot::EndPlot();
+        }
+        ImGui::PopID();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -1367,6 +1405,54 @@ void Demo_SubplotAxisLinking() {
 
 //-----------------------------------------------------------------------------
 
+void Demo_SubplotCellCaching() {
+    static ImPlotSubplotFlags flags = ImPlotSubplotFlags_CacheCells | ImPlotSubplotFlags_LinkAllX;
+    static bool animate = true;
+    ImGui::BulletText("With ImPlotSubplotFlags_CacheCells, clean cells replay their last draw data.");
+    ImGui::BulletText("Only the highlighted cell's data changes, so only it is marked dirty.");
+    ImGui::BulletText("Hovered cells are always rebuilt. See the metrics window for counts.");
+    ImGui::CheckboxFlags("ImPlotSubplotFlags_CacheCells", (unsigned int*)&flags, ImPlotSubplotFlags_CacheCells);
+    ImGui::SameLine();
+    ImGui::Checkbox("Animate", &animate);
+
+    static const int rows = 4, cols = 4;
+    static float phase[rows*cols] = {};
+    static int live = 0;
+    static double next_switch = 0;
+    const double now = ImGui::GetTime();
+    int prev_live = live;
+    if (animate && now >= next_switch) {
+        live = (live + 1) % (rows*cols);
+        next_switch = now + 1.0;
+    }
+    if (animate)
+        phase[live] += ImGui::GetIO().DeltaTime;
+
+    static float xs[500], ys[500];
+    if (ImPlot::BeginSubplots("##CellCaching", rows, cols, ImVec2(-1,600), flags)) {
+        // the previous live cell loses its highlight, so it must be rebuilt too
+        if (prev_live != live)
+            ImPlot::SetSubplotCellDirty(prev_live);
+        if (animate)
+            ImPlot::SetSubplotCellDirty(live);
+        for (int i = 0; i < rows*cols; ++i) {
+            if (ImPlot::BeginPlot("", ImVec2(), ImPlotFlags_NoLegend)) {
+                ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_NoTickLabels, ImPlotAxisFlags_NoTickLabels);
+                ImPlot::SetupAxesLimits(0, 10, -1.5, 1.5);
+                for (int j = 0; j < 500; ++j) {
+                    xs[j] = j * 0.02f;
+                    ys[j] = sinf(xs[j] * (1 + i * 0.25f) + phase[i]);
+                }
+                if (i == live)
+                    ImPlot::PlotShaded("##Fill", xs, ys, 500);
+                ImPlot::PlotLine("##Line", xs, ys, 500);
+                ImPlot::EndPlot();
+            }
+        }
+        ImPlot::EndSubplots();
+    }
+}
+
 void Demo_LegendOptions() {
     static ImPlotLocation loc = ImPlotLocation_East;
     ImGui::CheckboxFlags("North", (unsigned int*)&loc, ImPlotLocation_North); ImGui::SameLine();
@@ -1582,6 +1668,7 @@ void Demo_Querying() {
 
     ImGui::BulletText("Box select and left click mouse to create a new query rect.");
     ImGui::BulletText("Ctrl + click in the plot area to draw points.");
+    ImGui::BulletText("Hover a point to highlight it (see ImPlotItemFlags_SpatialIndex and QueryNearestPoint).");
 
     if (ImGui::Button("Clear Queries"))
         rects.shrink(0);
@@ -1592,7 +1679,15 @@ void Demo_Querying() {
             ImPlotPoint pt = ImPlot::GetPlotMousePos();
             data.push_back(pt);
         }
-        ImPlot::PlotScatter("Points", &data[0].x, &data[0].y, data.size(), 0, 0, 2 * sizeof(double));
+        ImPlot::PlotScatter("Points", &data[0].x, &data[0].y, data.size(), ImPlotItemFlags_SpatialIndex, 0, 2 * sizeof(double));
+        ImPlotPoint nearest;
+        if (ImPlot::IsPlotHovered() && ImPlot::QueryNearestPoint("Points", 8, &nearest) != -1) {
+            ImVec2 pix = ImPlot::PlotToPixels(nearest);
+            ImPlot::PushPlotClipRect();
+            ImPlot::GetPlotDrawList()->AddCircle(pix, 8, IM_COL32(255,255,0,255));
+            ImPlot::PopPlotClipRect();
+            ImGui::SetTooltip("(%.3f, %.3f)", nearest.x, nearest.y);
+        }
         if (ImPlot::IsPlotSelected()) {
             select = ImPlot::GetPlotSelection();
             int cnt;
@@ -2156,6 +2251,31 @@ void Demo_CustomPlottersAndTooltips()  {
     }
     }
 
+//-----------------------------------------------------------------------------
+
+void Demo_ArrayStatsBenchmark() {
+    ImGui::BulletText("ImPlot uses vectorized min/max, mean, and standard deviation routines for common types.");
+    ImGui::BulletText("These are used when fitting histograms and heatmaps, and can be used by custom plotters.");
+    ImGui::BulletText("Press Run to compare them against the generic versions. Large sizes may take a while!");
+    MyImPlot::BenchmarkArrayStats();
+}
+
+void Demo_TimeAxisBenchmark() {
+    ImGui::BulletText("Time axis ticks are located and formatted with arithmetic civil time conversions.");
+    ImGui::BulletText("Local time uses UTC offset transitions cached from the C runtime on first use.");
+    ImGui::BulletText("Press Run to time tick generation for ranges from microseconds to centuries.");
+    MyImPlot::BenchmarkTimeAxis();
+}
+
+void Demo_ShadedBenchmark() {
+    ImGui::BulletText("PlotShaded can cull a band with ImPlotItemFlags_SortedX to the visible X range, and reduce it");
+    ImGui::Indent();
+    ImGui::Text("to the envelope of each pixel column with ImPlotShadedFlags_Downsample.");
+    ImGui::Unindent();
+    ImGui::BulletText("Press Run to time PlotShaded with each mode for the full band and a 1%% zoomed view.");
+    MyImPlot::BenchmarkShaded();
+}
+
 //-----------------------------------------------------------------------------
 // DEMO WINDOW
 //-----------------------------------------------------------------------------
@@ -2249,6 +2369,7 @@ void ShowDemoWindow(bool* p_open) {
             DemoHeader("Sizing", Demo_SubplotsSizing);
             DemoHeader("Item Sharing", Demo_SubplotItemSharing);
             DemoHeader("Axis Linking", Demo_SubplotAxisLinking);
+            DemoHeader("Cell Caching", Demo_SubplotCellCaching);
             DemoHeader("Tables", Demo_Tables);
             ImGui::EndTabItem();
         }
@@ -2286,6 +2407,12 @@ void ShowDemoWindow(bool* p_open) {
             DemoHeader("Custom Plotters and Tooltips", Demo_CustomPlottersAndTooltips);
             ImGui::EndTabItem();
         }
+        if (ImGui::BeginTabItem("Benchmarks")) {
+            DemoHeader("Array Statistics", Demo_ArrayStatsBenchmark);
+            DemoHeader("Time Axis", Demo_TimeAxisBenchmark);
+            DemoHeader("Shaded Plots", Demo_ShadedBenchmark);
+            ImGui::EndTabItem();
+        }
         if (ImGui::BeginTabItem("Config")) {
             Demo_Config();
             ImGui::EndTabItem();
@@ -2399,6 +2526,7 @@ void StyleSeaborn() {
 // custom plotters. For now, proceed at your own risk!
 
 #include "implot_internal.h"
+#include <chrono>
 
 namespace MyImPlot {
 
@@ -2476,4 +2604,289 @@ void PlotCandlestick(const char* label_id, const double* xs, const double* opens
     }
 }
 
+// Times a function in milliseconds, taking the best of several runs
+template <typename F>
+double BenchmarkMs(F func, int runs = 5) {
+    double best = DBL_MAX;
+    for (int r = 0; r < runs; ++r) {
+        auto t0 = std::chrono::high_resolution_clock::now();
+        func();
+        auto t1 = std::chrono::high_resolution_clock::now();
+        best = ImMin(best, std::chrono::duration<double, std::milli>(t1 - t0).count());
+    }
+    return best;
+}
+
+// Times the generic (0) and vectorized (1) versions of ImMinMaxArray, ImMean, and ImStdDev for type T
+template <typename T>
+void BenchmarkArrayStats(int count, double lo, double hi, double results[3][2]) {
+    ImVector<T> values;
+    values.resize(count);
+    for (int i = 0; i < count; ++i)
+        values[i] = (T)ImPlot::RandomRange(lo, hi);
+    T mn, mx;
+    volatile double sink = 0;
+    results[0][0] = BenchmarkMs([&]() { ImMinMaxArray<T>(values.Data, count, &mn, &mx); sink = (double)mn + (double)mx; });
+    results[0][1] = BenchmarkMs([&]() { ImMinMaxArray(values.Data, count, &mn, &mx);    sink = (double)mn + (double)mx; });
+    results[1][0] = BenchmarkMs([&]() { sink = ImMean<T>(values.Data, count);   });
+    results[1][1] = BenchmarkMs([&]() { sink = ImMean(values.Data, count);      });
+    results[2][0] = BenchmarkMs([&]() { sink = ImStdDev<T>(values.Data, count); });
+    results[2][1] = BenchmarkMs([&]() { sink = ImStdDev(values.Data, count);    });
+}
+
+// Returns true if the vectorized ImMinMaxArray skips a NaN in the middle of the data like the generic version, for all lengths up to 256
+template <typename T>
+bool CheckMinMaxNaN() {
+    ImVector<T> values;
+    for (int count = 2; count <= 256; ++count) {
+        values.resize(count);
+        for (int i = 0; i < count; ++i)
+            values[i] = (T)(i % 7) - (T)(i % 5);
+        values[count / 2] = (T)NAN;
+        T mn0, mx0, mn1, mx1;
+        ImMinMaxArray<T>(values.Data, count, &mn0, &mx0);
+        ImMinMaxArray(values.Data, count, &mn1, &mx1);
+        if (mn0 != mn1 || mx0 != mx1)
+            return false;
+    }
+    return true;
+}
+
+void BenchmarkArrayStats() {
+    static const char* size_names[] = {"1M", "10M", "100M"};
+    static const int   sizes[]      = {1000000, 10000000, 100000000};
+    static const char* type_names[] = {"float", "double", "ImS32", "ImU8", "ImU16"};
+    static const char* func_names[] = {"MinMax", "Mean", "StdDev"};
+    static int    size_idx  = 0;
+    static double results[5][3][2];
+    static bool   has_results = false;
+
+    static const bool nan_ok = CheckMinMaxNaN<float>() && CheckMinMaxNaN<double>();
+    ImGui::Text("Instruction Set: %s", ImSimdInstructionSet());
+    ImGui::Text("MinMax with NaNs: %s", nan_ok ? "matches generic" : "differs from generic!");
+    ImGui::SetNextItemWidth(100);
+    ImGui::Combo("Elements", &size_idx, size_names, IM_ARRAYSIZE(size_names));
+    ImGui::SameLine();
+    if (ImGui::Button("Run")) {
+        const int count = sizes[size_idx];
+        BenchmarkArrayStats<float> (count, -1000, 1000, results[0]);
+        BenchmarkArrayStats<double>(count, -1000, 1000, results[1]);
+        BenchmarkArrayStats<ImS32> (count, -1e9,  1e9,  results[2]);
+        BenchmarkArrayStats<ImU8>  (count, 0,     255,  results[3]);
+        BenchmarkArrayStats<ImU16> (count, 0,     65535,results[4]);
+        has_results = true;
+    }
+    if (!has_results)
+        return;
+
+    if (ImGui::BeginTable("##ArrayStats", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        ImGui::TableSetupColumn("Function");
+        ImGui::TableSetupColumn("Generic (ms)");
+        ImGui::TableSetupColumn("SIMD (ms)");
+        ImGui::TableSetupColumn("Speedup");
+        ImGui::TableHeadersRow();
+        for (int t = 0; t < 5; ++t) {
+            for (int f = 0; f < 3; ++f) {
+                ImGui::TableNextRow();
+                ImGui::TableSetColumnIndex(0); ImGui::Text("%s<%s>", func_names[f], type_names[t]);
+                ImGui::TableSetColumnIndex(1); ImGui::Text("%.3f", results[t][f][0]);
+                ImGui::TableSetColumnIndex(2); ImGui::Text("%.3f", results[t][f][1]);
+                ImGui::TableSetColumnIndex(3); ImGui::Text("%.1fx", results[t][f][0] / ImMax(results[t][f][1], 1e-6));
+            }
+        }
+        ImGui::EndTable();
+    }
+
+    // speedups grouped by type
+    double speedups[3][5];
+    for (int f = 0; f < 3; ++f)
+        for (int t = 0; t < 5; ++t)
+            speedups[f][t] = results[t][f][0] / ImMax(results[t][f][1], 1e-6);
+    if (ImPlot::BeginPlot("Speedup", ImVec2(-1,0), ImPlotFlags_NoMouseText)) {
+        ImPlot::SetupAxes(nullptr, "Speedup", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+        ImPlot::SetupAxisTicks(ImAxis_X1, 0, 4, 5, type_names);
+        ImPlot::PlotBarGroups(func_names, &speedups[0][0], 3, 5, 0.67);
+        ImPlot::EndPlot();
+    }
+}
+
+// Times one Locator_Time call in microseconds for a range of #span seconds
+double BenchmarkLocateTime(double span, bool local_time) {
+    const bool use_local = ImPlot::GetStyle().UseLocalTime;
+    ImPlot::GetStyle().UseLocalTime = local_time;
+    ImPlotTicker ticker;
+    const double origin = 1577836800; // 2020-01-01
+    const int    calls  = 100;
+    const double ms = BenchmarkMs([&]() {
+        for (int i = 0; i < calls; ++i) {
+            ticker.Reset();
+            ImPlot::Locator_Time(ticker, ImPlotRange(origin + i * span * 0.01, origin + i * span * 0.01 + span), 1000, false, nullptr, nullptr);
+        }
+    });
+    ImPlot::GetStyle().UseLocalTime = use_local;
+    return ms * 1000 / calls;
+}
+
+// Times 100K ImPlot (0) and C runtime (1) time conversions in milliseconds
+void BenchmarkTimeConversions(double results[5][2]) {
+    const int count = 100000;
+    tm Tm;
+    volatile time_t sink = 0;
+    // local times spread over 30 years in shuffled order, as converted for the ticks of a 30 year axis
+    auto decades = [](int i) { return (time_t)631152000 + (time_t)((i * 7919) % count) * 9467; };
+    results[0][0] = BenchmarkMs([&]() { for (int i = 0; i < count; ++i) { ImPlot::GetGmtTime(ImPlotTime(i * 997), &Tm); sink = Tm.tm_mday; } });
+    results[1][0] = BenchmarkMs([&]() { for (int i = 0; i < count; ++i) { Tm.tm_sec = i; sink = ImPlot::MkGmtTime(&Tm).S; } });
+    results[2][0] = BenchmarkMs([&]() { for (int i = 0; i < count; ++i) { ImPlot::GetLocTime(ImPlotTime(i * 997), &Tm); sink = Tm.tm_mday; } });
+    results[3][0] = BenchmarkMs([&]() { for (int i = 0; i < count; ++i) { Tm.tm_sec = i; sink = ImPlot::MkLocTime(&Tm).S; } });
+    results[4][0] = BenchmarkMs([&]() { for (int i = 0; i < count; ++i) { ImPlot::GetLocTime(ImPlotTime(decades(i)), &Tm); sink = Tm.tm_mday; } });
+#ifdef _WIN32
+    results[0][1] = BenchmarkMs([&]() { for (int i = 0; i < count; ++i) { time_t s = i * 997; gmtime_s(&Tm, &s); sink = Tm.tm_mday; } });
+    results[1][1] = BenchmarkMs([&]() { for (int i = 0; i < count; ++i) { Tm.tm_sec = i; sink = _mkgmtime(&Tm); } });
+    results[2][1] = BenchmarkMs([&]() { for (int i = 0; i < count; ++i) { time_t s = i * 997; localtime_s(&Tm, &s); sink = Tm.tm_mday; } });
+    results[4][1] = BenchmarkMs([&]() { for (int i = 0; i < count; ++i) { time_t s = decades(i); localtime_s(&Tm, &s); sink = Tm.tm_mday; } });
+#else
+    results[0][1] = BenchmarkMs([&]() { for (int i = 0; i < count; ++i) { time_t s = i * 997; gmtime_r(&s, &Tm); sink = Tm.tm_mday; } });
+    results[1][1] = BenchmarkMs([&]() { for (int i = 0; i < count; ++i) { Tm.tm_sec = i; sink = timegm(&Tm); } });
+    results[2][1] = BenchmarkMs([&]() { for (int i = 0; i < count; ++i) { time_t s = i * 997; localtime_r(&s, &Tm); sink = Tm.tm_mday; } });
+    results[4][1] = BenchmarkMs([&]() { for (int i = 0; i < count; ++i) { time_t s = decades(i); localtime_r(&s, &Tm); sink = Tm.tm_mday; } });
+#endif
+    results[3][1] = BenchmarkMs([&]() { for (int i = 0; i < count; ++i) { Tm.tm_sec = i; sink = mktime(&Tm); } });
+}
+
+void BenchmarkTimeAxis() {
+    static const char*  span_names[] = {"1 ms", "1 s", "1 min", "1 hr", "1 day", "1 mo", "1 yr", "10 yr", "30 yr", "100 yr"};
+    static const double spans[]      = {0.001, 1, 60, 3600, 86400, 2629800, 31557600, 315576000, 946728000, 3155760000};
+    static const char*  zone_names[] = {"UTC", "Local"};
+    static const char*  conv_names[] = {"GetGmtTime", "MkGmtTime", "GetLocTime", "MkLocTime", "GetLocTime (30 yr)"};
+    static double locate[2][10];
+    static double convert[5][2];
+    static bool   has_results = false;
+
+    if (ImGui::Button("Run")) {
+        for (int z = 0; z < 2; ++z)
+            for (int s = 0; s < 10; ++s)
+                locate[z][s] = BenchmarkLocateTime(spans[s], z == 1);
+        BenchmarkTimeConversions(convert);
+        has_results = true;
+    }
+    if (!has_results)
+        return;
+
+    if (ImGui::BeginTable("##TimeConversions", 4, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        ImGui::TableSetupColumn("100K Conversions");
+        ImGui::TableSetupColumn("ImPlot (ms)");
+        ImGui::TableSetupColumn("C Runtime (ms)");
+        ImGui::TableSetupColumn("Speedup");
+        ImGui::TableHeadersRow();
+        for (int f = 0; f < 5; ++f) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0); ImGui::Text("%s", conv_names[f]);
+            ImGui::TableSetColumnIndex(1); ImGui::Text("%.3f", convert[f][0]);
+            ImGui::TableSetColumnIndex(2); ImGui::Text("%.3f", convert[f][1]);
+            ImGui::TableSetColumnIndex(3); ImGui::Text("%.1fx", convert[f][1] / ImMax(convert[f][0], 1e-6));
+        }
+        ImGui::EndTable();
+    }
+
+    if (ImPlot::BeginPlot("Locator_Time", ImVec2(-1,0), ImPlotFlags_NoMouseText)) {
+        ImPlot::SetupAxes("Range", "Time per Call (us)", ImPlotAxisFlags_AutoFit, ImPlotAxisFlags_AutoFit);
+        ImPlot::SetupAxisTicks(ImAxis_X1, 0, 9, 10, span_names);
+        ImPlot::PlotBarGroups(zone_names, &locate[0][0], 2, 10, 0.67);
+        ImPlot::EndPlot();
+    }
+}
+
+void BenchmarkShaded() {
+    static const char* size_names[] = {"1M", "10M"};
+    static const int   sizes[]      = {1000000, 10000000};
+    static const char* mode_names[] = {"Default", "SortedX", "SortedX + Downsample"};
+    static const ImPlotShadedFlags mode_flags[] = {ImPlotShadedFlags_None, ImPlotItemFlags_SortedX, ImPlotItemFlags_SortedX | ImPlotShadedFlags_Downsample};
+    static const int frames = 10; // frames timed for each mode and view
+    static int    size_idx = 1;
+    static int    run = -1;       // frame of the current run, or -1 if idle
+    static double results[3][2];  // best time of each mode for the full and zoomed view
+    static int    vertices[3][2];
+    static bool   has_results = false;
+    static ImVector<float> xs, ys1, ys2;
+    static float  y_min, y_max;
+
+    ImGui::SetNextItemWidth(100);
+    ImGui::Combo("Points", &size_idx, size_names, IM_ARRAYSIZE(size_names));
+    ImGui::SameLine();
+    if (ImGui::Button("Run") && run < 0) {
+        const int count = sizes[size_idx];
+        if (xs.Size != count) {
+            xs.resize(count);
+            ys1.resize(count);
+            ys2.resize(count);
+            double y = 0;
+            for (int i = 0; i < count; ++i) {
+                y += ImPlot::RandomRange(-1.0, 1.0);
+                xs[i]  = (float)i;
+                ys1[i] = (float)(y - ImPlot::RandomRange(1.0, 20.0));
+                ys2[i] = (float)(y + ImPlot::RandomRange(1.0, 20.0));
+            }
+            ImMinMaxArray(ys1.Data, count, &y_min, &y_max);
+            float mn, mx;
+            ImMinMaxArray(ys2.Data, count, &mn, &mx);
+            y_min = ImMin(y_min, mn);
+            y_max = ImMax(y_max, mx);
+        }
+        for (int m = 0; m < 3; ++m)
+            for (int v = 0; v < 2; ++v)
+                results[m][v] = DBL_MAX;
+        run = 0;
+    }
+    if (xs.Size == 0)
+        return;
+
+    // each mode is timed for several frames with the full band in view, then with the middle 1% of it
+    const int mode = run >= 0 ? (run / frames) % 3 : 2;
+    const int view = run >= 0 ? (run / frames) / 3 : 0;
+    if (run >= 0)
+        ImGui::Text("Running %s (%s view)...", mode_names[mode], view == 0 ? "full" : "zoomed");
+    if (ImPlot::BeginPlot("##ShadedBenchmark", ImVec2(-1,0), ImPlotFlags_NoMouseText)) {
+        if (run >= 0) {
+            const double span = view == 0 ? xs.Size : xs.Size * 0.01;
+            ImPlot::SetupAxesLimits((xs.Size - span) / 2, (xs.Size + span) / 2, y_min, y_max, ImGuiCond_Always);
+        }
+        ImDrawList& draw_list = *ImPlot::GetPlotDrawList();
+        const int vtx = draw_list.VtxBuffer.Size;
+        auto t0 = std::chrono::high_resolution_clock::now();
+        ImPlot::PlotShaded("Band", xs.Data, ys1.Data, ys2.Data, xs.Size, mode_flags[mode]);
+        auto t1 = std::chrono::high_resolution_clock::now();
+        if (run >= 0) {
+            results[mode][view]  = ImMin(results[mode][view], std::chrono::duration<double, std::milli>(t1 - t0).count());
+            vertices[mode][view] = draw_list.VtxBuffer.Size - vtx;
+            if (++run == frames * 6) {
+                run = -1;
+                has_results = true;
+            }
+        }
+        ImPlot::EndPlot();
+    }
+    if (!has_results)
+        return;
+
+    if (ImGui::BeginTable("##Shaded", 6, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg)) {
+        ImGui::TableSetupColumn("Mode");
+        ImGui::TableSetupColumn("Full View (ms)");
+        ImGui::TableSetupColumn("Vertices");
+        ImGui::TableSetupColumn("1% View (ms)");
+        ImGui::TableSetupColumn("Vertices");
+        ImGui::TableSetupColumn("Speedup");
+        ImGui::TableHeadersRow();
+        for (int m = 0; m < 3; ++m) {
+            ImGui::TableNextRow();
+            ImGui::TableSetColumnIndex(0); ImGui::Text("%s", mode_names[m]);
+            ImGui::TableSetColumnIndex(1); ImGui::Text("%.3f", results[m][0]);
+            ImGui::TableSetColumnIndex(2); ImGui::Text("%d", vertices[m][0]);
+            ImGui::TableSetColumnIndex(3); ImGui::Text("%.3f", results[m][1]);
+            ImGui::TableSetColumnIndex(4); ImGui::Text("%d", vertices[m][1]);
+            ImGui::TableSetColumnIndex(5); ImGui::Text("%.1fx / %.1fx", results[0][0] / ImMax(results[m][0], 1e-6), results[0][1] / ImMax(results[m][1], 1e-6));
+        }
+        ImGui::EndTable();
+    }
+}
+
 } // namespace MyImplot
@@ -59,6 +59,11 @@
 #define IMPLOT_LABEL_FORMAT "%g"
 // Max character size for tick labels
 #define IMPLOT_LABEL_MAX_SIZE 32
+// Number of sets and ways of the per-axis tick label cache (sets must be a power of two)
+#define IMPLOT_TICK_LABEL_CACHE_SETS 32
+#define IMPLOT_TICK_LABEL_CACHE_WAYS 4
+// Number of tick layouts shared by the members of an axis link group (one per distinct member size and format)
+#define IMPLOT_LINK_GROUP_TICK_CACHES 4
 
 //-----------------------------------------------------------------------------
 // [SECTION] Macros
@@ -139,7 +144,26 @@ static inline T ImMinArray(const T* values, int count) { T m = values[0]; for (i
 // Finds the max value in an unsorted array
 template <typename T>
 static inline T ImMaxArray(const T* values, int count) { T m = values[0]; for (int i = 1; i < count; ++i) { if (values[i] > m) { m = values[i]; } } return m; }
-// Finds the min and max value in an unsorted array
+// Vectorized overloads of ImMinMaxArray, ImMean and ImStdDev (see implot_items.cpp). Call ImMinMaxArray<T> etc. for the generic versions.
+IMPLOT_API void ImMinMaxArray(const float*  values, int count, float*  min_out, float*  max_out);
+IMPLOT_API void ImMinMaxArray(const double* values, int count, double* min_out, double* max_out);
+IMPLOT_API void ImMinMaxArray(const ImS32*  values, int count, ImS32*  min_out, ImS32*  max_out);
+IMPLOT_API void ImMinMaxArray(const ImU8*   values, int count, ImU8*   min_out, ImU8*   max_out);
+IMPLOT_API void ImMinMaxArray(const ImU16*  values, int count, ImU16*  min_out, ImU16*  max_out);
+IMPLOT_API double ImMean(const float*  values, int count);
+IMPLOT_API double ImMean(const double* values, int count);
+IMPLOT_API double ImMean(const ImS32*  values, int count);
+IMPLOT_API double ImMean(const ImU8*   values, int count);
+IMPLOT_API double ImMean(const ImU16*  values, int count);
+IMPLOT_API double ImStdDev(const float*  values, int count);
+IMPLOT_API double ImStdDev(const double* values, int count);
+IMPLOT_API double ImStdDev(const ImS32*  values, int count);
+IMPLOT_API double ImStdDev(const ImU8*   values, int count);
+IMPLOT_API double ImStdDev(const ImU16*  values, int count);
+// Returns the name of the instruction set used by the vectorized overloads ("AVX2", "SSE2", "NEON", or "None")
+IMPLOT_API const char* ImSimdInstructionSet();
+// Finds the min and max value in an unsorted array. NaNs are skipped, unless the first value is NaN, in which case both
+// are NaN. The vectorized overloads give the same results.
 template <typename T>
 static inline void ImMinMaxArray(const T* values, int count, T* min_out, T* max_out) {
     T Min = values[0]; T Max = values[0];
@@ -289,6 +313,21 @@ struct ImPlotDateTimeSpec {
     bool Use24HourClock;
 };
 
+// Local time UTC offset in effect from a UNIX timestamp until the next transition.
+struct ImPlotTzTransition {
+    time_t S;
+    int    Offset; // seconds east of UTC
+    bool   IsDst;
+};
+
+// Local time transitions within one fixed span of time (see GetTzTransition in implot.cpp).
+struct ImPlotTzSpan {
+    ImS64                        Index;        // span number, counted from the UNIX epoch
+    ImVector<ImPlotTzTransition> Transitions;  // sorted, the first one starts at the beginning of the span
+
+    ImPlotTzSpan() { Index = 0; }
+};
+
 // Two part timestamp struct.
 struct ImPlotTime {
     time_t S;  // second part
@@ -321,6 +360,7 @@ struct ImPlotColormapData {
     ImVector<int>   KeyCounts;
     ImVector<int>   KeyOffsets;
     ImVector<ImU32> Tables;
+    ImVector<ImVec4> TablesVec4;   // Tables converted to ImVec4, so SampleColormap is a lookup
     ImVector<int>   TableSizes;
     ImVector<int>   TableOffsets;
     ImGuiTextBuffer Text;
@@ -328,8 +368,10 @@ struct ImPlotColormapData {
     ImVector<bool>  Quals;
     ImGuiStorage    Map;
     int             Count;
+    int             TableSize;     // number of entries in continuous tables, or 0 for 255 entries per pair of keys
+    int             Generation;    // incremented when the tables are rebuilt, as cached vertices of existing colormaps may be stale
 
-    ImPlotColormapData() { Count = 0; }
+    ImPlotColormapData() { Count = 0; TableSize = 0; Generation = 0; }
 
     int Append(const char* name, const ImU32* keys, int count, bool qual) {
         if (GetIndex(name) != -1)
@@ -360,6 +402,17 @@ struct ImPlotColormapData {
                 Tables.push_back(keys[i]);
             TableSizes.push_back(key_count);
         }
+        else if (TableSize > 0) {
+            // sample the keys at TableSize evenly spaced positions
+            const int size = ImMax(TableSize, key_count);
+            Tables.reserve(off + size);
+            for (int j = 0; j < size; ++j) {
+                const float x = (float)j * (key_count - 1) / (size - 1);
+                const int i = ImMin((int)x, key_count - 2);
+                Tables.push_back(ImMixU32(keys[i], keys[i+1], (ImU32)((x - i) * 256 + 0.5f)));
+            }
+            TableSizes.push_back(size);
+        }
         else {
             int max_size = 255 * (key_count-1) + 1;
             Tables.reserve(off + max_size);
@@ -386,14 +439,19 @@ struct ImPlotColormapData {
             // TableSizes.push_back(n);
             TableSizes.push_back(max_size);
         }
+        TablesVec4.resize(Tables.size());
+        for (int i = off; i < Tables.size(); ++i)
+            TablesVec4[i] = ImGui::ColorConvertU32ToFloat4(Tables[i]);
     }
 
     void RebuildTables() {
         Tables.resize(0);
+        TablesVec4.resize(0);
         TableSizes.resize(0);
         TableOffsets.resize(0);
         for (int i = 0; i < Count; ++i)
             _AppendTable(i);
+        Generation++;
     }
 
     inline bool           IsQual(ImPlotColormap cmap) const                      { return Quals[cmap];                                                }
@@ -415,6 +473,13 @@ struct ImPlotColormapData {
         int idx = Quals[cmap] ? ImClamp((int)(siz*t),0,siz-1) : (int)((siz - 1) * t + 0.5f);
         return Tables[off + idx];
     }
+
+    inline const ImVec4& LerpTableVec4(ImPlotColormap cmap, float t) const {
+        int off = TableOffsets[cmap];
+        int siz = TableSizes[cmap];
+        int idx = Quals[cmap] ? ImClamp((int)(siz*t),0,siz-1) : (int)((siz - 1) * t + 0.5f);
+        return TablesVec4[off + idx];
+    }
 };
 
 // ImPlotPoint with positive/negative error values
@@ -550,18 +615,59 @@ struct ImPlotTick
     }
 };
 
+// Formatted and measured tick label, cached by value
+struct ImPlotTickLabel
+{
+    ImGuiID      Key;
+    double       Value;
+    unsigned int LastUse;
+    ImVec2       Size;
+    char         Text[IMPLOT_LABEL_MAX_SIZE];
+
+    ImPlotTickLabel() { Key = 0; Value = 0; LastUse = 0; Text[0] = 0; }
+};
+
 // Collection of ticks
 struct ImPlotTicker {
-    ImVector<ImPlotTick> Ticks;
-    ImGuiTextBuffer      TextBuffer;
-    ImVec2               MaxSize;
-    ImVec2               LateSize;
-    int                  Levels;
+    ImVector<ImPlotTick>      Ticks;
+    ImGuiTextBuffer           TextBuffer;
+    ImVec2                    MaxSize;
+    ImVec2                    LateSize;
+    int                       Levels;
+    ImVector<ImPlotTickLabel> Labels;     // set associative LRU cache of formatted labels, allocated on first use
+    ImGuiID                   LabelKey;   // identifies the formatter, format and font of the labels; 0 disables the cache
+    unsigned int              LabelClock;
 
     ImPlotTicker() {
+        LabelKey   = 0;
+        LabelClock = 0;
         Reset();
     }
 
+    // Returns the label for #value, only calling #formatter and CalcTextSize if it is not cached. #seed
+    // distinguishes labels of the same value produced by different formats (e.g. time levels).
+    const ImPlotTickLabel& FormatLabel(double value, ImPlotFormatter formatter, void* data, ImGuiID seed) {
+        if (Labels.Size == 0)
+            Labels.resize(IMPLOT_TICK_LABEL_CACHE_SETS * IMPLOT_TICK_LABEL_CACHE_WAYS, ImPlotTickLabel());
+        const ImGuiID key = ImHashData(&value, sizeof(value), LabelKey + seed);
+        ImPlotTickLabel* set = &Labels[(key & (IMPLOT_TICK_LABEL_CACHE_SETS - 1)) * IMPLOT_TICK_LABEL_CACHE_WAYS];
+        ImPlotTickLabel* lru = set;
+        for (int i = 0; i < IMPLOT_TICK_LABEL_CACHE_WAYS; ++i) {
+            if (set[i].LastUse != 0 && set[i].Key == key && set[i].Value == value) {
+                set[i].LastUse = ++LabelClock;
+                return set[i];
+            }
+            if (set[i].LastUse < lru->LastUse)
+                lru = &set[i];
+        }
+        formatter(value, lru->Text, sizeof(lru->Text), data);
+        lru->Key     = key;
+        lru->Value   = value;
+        lru->Size    = ImGui::CalcTextSize(lru->Text);
+        lru->LastUse = ++LabelClock;
+        return *lru;
+    }
+
     ImPlotTick& AddTick(double value, bool major, int level, bool show_label, const char* label) {
         ImPlotTick tick(value, major, level, show_label);
         if (show_label && label != nullptr) {
@@ -572,14 +678,21 @@ struct ImPlotTicker {
         return AddTick(tick);
     }
 
-    ImPlotTick& AddTick(double value, bool major, int level, bool show_label, ImPlotFormatter formatter, void* data) {
+    ImPlotTick& AddTick(double value, bool major, int level, bool show_label, ImPlotFormatter formatter, void* data, ImGuiID label_seed = 0) {
         ImPlotTick tick(value, major, level, show_label);
         if (show_label && formatter != nullptr) {
-            char buff[IMPLOT_LABEL_MAX_SIZE];
             tick.TextOffset = TextBuffer.size();
-            formatter(tick.PlotPos, buff, sizeof(buff), data);
-            TextBuffer.append(buff, buff + strlen(buff) + 1);
-            tick.LabelSize = ImGui::CalcTextSize(TextBuffer.Buf.Data + tick.TextOffset);
+            if (LabelKey != 0) {
+                const ImPlotTickLabel& label = FormatLabel(tick.PlotPos, formatter, data, label_seed);
+                TextBuffer.append(label.Text, label.Text + strlen(label.Text) + 1);
+                tick.LabelSize = label.Size;
+            }
+            else {
+                char buff[IMPLOT_LABEL_MAX_SIZE];
+                formatter(tick.PlotPos, buff, sizeof(buff), data);
+                TextBuffer.append(buff, buff + strlen(buff) + 1);
+                tick.LabelSize = ImGui::CalcTextSize(TextBuffer.Buf.Data + tick.TextOffset);
+            }
         }
         return AddTick(tick);
     }
@@ -620,6 +733,53 @@ struct ImPlotTicker {
     }
 };
 
+// Ticks produced by an axis locator, reused while the inputs identified by Key are unchanged
+struct ImPlotTickCache
+{
+    ImGuiID              Key;
+    ImVector<ImPlotTick> Ticks;      // TextOffset is relative to TextBuffer
+    ImGuiTextBuffer      TextBuffer;
+
+    ImPlotTickCache() { Key = 0; }
+};
+
+// Limits and tick marks shared by the axes of a link group (see CreateAxisLinkGroup)
+struct ImPlotAxisLinkGroup
+{
+    ImGuiID         ID;
+    ImPlotRange     Range;      // limits members adopt in the current frame, before their own input is applied
+    ImPlotRange     NextRange;  // limits pushed by members, applied at the start of the next frame
+    int             Frame;
+    ImPlotTickCache TickCache[IMPLOT_LINK_GROUP_TICK_CACHES];
+    int             TickCacheFrame[IMPLOT_LINK_GROUP_TICK_CACHES];
+
+    ImPlotAxisLinkGroup() {
+        ID    = 0;
+        Range = NextRange = ImPlotRange(0,1);
+        Frame = -1;
+        for (int i = 0; i < IMPLOT_LINK_GROUP_TICK_CACHES; ++i)
+            TickCacheFrame[i] = -1;
+    }
+
+    // Returns the tick cache entry for #key, or an entry unused since before the previous frame if there is none.
+    // Returns nullptr if all entries are in use, in which case members fall back to their own cache.
+    ImPlotTickCache* GetTickCache(ImGuiID key, int frame) {
+        int idx = -1;
+        for (int i = 0; i < IMPLOT_LINK_GROUP_TICK_CACHES; ++i) {
+            if (TickCache[i].Key == key) {
+                idx = i;
+                break;
+            }
+            if ((TickCache[i].Key == 0 || TickCacheFrame[i] < frame - 1) && (idx == -1 || TickCacheFrame[i] < TickCacheFrame[idx]))
+                idx = i;
+        }
+        if (idx == -1)
+            return nullptr;
+        TickCacheFrame[idx] = frame;
+        return &TickCache[idx];
+    }
+};
+
 // Axis state information that must persist after EndPlot
 struct ImPlotAxis
 {
@@ -635,6 +795,7 @@ struct ImPlotAxis
     ImPlotRange          ConstraintZoom;
 
     ImPlotTicker         Ticker;
+    ImPlotTickCache      TickCache;
     ImPlotFormatter      Formatter;
     void*                FormatterData;
     char                 FormatSpec[16];
@@ -642,6 +803,7 @@ struct ImPlotAxis
 
     double*              LinkedMin;
     double*              LinkedMax;
+    ImGuiID              LinkGroup;
 
     int                  PickerLevel;
     ImPlotTime           PickerTimeMin, PickerTimeMax;
@@ -681,6 +843,7 @@ struct ImPlotAxis
         ConstraintRange  = ImPlotRange(-INFINITY,INFINITY);
         ConstraintZoom   = ImPlotRange(DBL_MIN,INFINITY);
         LinkedMin        = LinkedMax = nullptr;
+        LinkGroup        = 0;
         PickerLevel      = 0;
         Datum1           = Datum2 = 0;
         PixelMin         = PixelMax = 0;
@@ -711,6 +874,7 @@ struct ImPlotAxis
         OrthoAxis        = nullptr;
         ConstraintRange  = ImPlotRange(-INFINITY,INFINITY);
         ConstraintZoom   = ImPlotRange(DBL_MIN,INFINITY);
+        LinkGroup        = 0;
         Ticker.Reset();
     }
 
@@ -877,7 +1041,7 @@ struct ImPlotAxis
     inline bool IsInverted()        const { return ImHasFlag(Flags, ImPlotAxisFlags_Invert);                                                 }
     inline bool IsForeground()      const { return ImHasFlag(Flags, ImPlotAxisFlags_Foreground);                                             }
     inline bool IsAutoFitting()     const { return ImHasFlag(Flags, ImPlotAxisFlags_AutoFit);                                                }
-    inline bool CanInitFit()        const { return !ImHasFlag(Flags, ImPlotAxisFlags_NoInitialFit) && !HasRange && !LinkedMin && !LinkedMax; }
+    inline bool CanInitFit()        const { return !ImHasFlag(Flags, ImPlotAxisFlags_NoInitialFit) && !HasRange && !LinkedMin && !LinkedMax && !LinkGroup; }
     inline bool IsRangeLocked()     const { return HasRange && RangeCond == ImPlotCond_Always;                                               }
     inline bool IsLockedMin()       const { return !Enabled || IsRangeLocked() || ImHasFlag(Flags, ImPlotAxisFlags_LockMin);                 }
     inline bool IsLockedMax()       const { return !Enabled || IsRangeLocked() || ImHasFlag(Flags, ImPlotAxisFlags_LockMax);                 }
@@ -946,6 +1110,8 @@ struct ImPlotItem
     bool         Show;
     bool         LegendHovered;
     bool         SeenThisFrame;
+    bool         Plotted;       // false until the item is plotted for the first time (it may be registered earlier by RegisterItem)
+    ImPlotProfile Profile;      // profile of the last frame the item was profiled in, summed over the times it was plotted
 
     ImPlotItem() {
         ID            = 0;
@@ -954,6 +1120,7 @@ struct ImPlotItem
         Show          = true;
         SeenThisFrame = false;
         LegendHovered = false;
+        Plotted       = false;
     }
 
     ~ImPlotItem() { ID = 0; }
@@ -968,7 +1135,8 @@ struct ImPlotLegend
     ImPlotLocation    PreviousLocation;
     ImVec2            Scroll;
     ImVector<int>     Indices;
-    ImGuiTextBuffer   Labels;
+    ImGuiTextBuffer   Labels;         // labels of the items, kept across frames while unchanged
+    int               LabelsUnused;   // size of the labels which have since been replaced
     ImRect            Rect;
     ImRect            RectClamped;
     bool              Hovered;
@@ -981,9 +1149,10 @@ struct ImPlotLegend
         Hovered      = Held = false;
         Location     = PreviousLocation = ImPlotLocation_NorthWest;
         Scroll       = ImVec2(0,0);
+        LabelsUnused = 0;
     }
 
-    void Reset() { Indices.shrink(0); Labels.Buf.shrink(0); }
+    void Reset() { Indices.shrink(0); Labels.Buf.shrink(0); LabelsUnused = 0; }
 };
 
 // Holds Items and Legend data
@@ -1007,6 +1176,36 @@ struct ImPlotItemGroup
     ImPlotItem* GetLegendItem(int i)             { return ItemPool.GetByIndex(Legend.Indices[i]);                }
     const char* GetLegendLabel(int i)            { return Legend.Labels.Buf.Data + GetLegendItem(i)->NameOffset; }
     void        Reset()                          { ItemPool.Clear(); Legend.Reset(); ColormapIdx = 0;            }
+
+    // Sets the label of an item, copying it only if it has changed
+    void SetItemLabel(ImPlotItem* item, const char* label_id) {
+        const char* label = item->NameOffset != -1 ? Legend.Labels.Buf.Data + item->NameOffset : nullptr;
+        if (label != nullptr && strcmp(label, label_id) == 0)
+            return;
+        if (label != nullptr)
+            Legend.LabelsUnused += (int)strlen(label) + 1;
+        item->NameOffset = Legend.Labels.size();
+        Legend.Labels.append(label_id, label_id + strlen(label_id) + 1);
+    }
+
+    // Clears the legend for a new frame, and discards replaced labels once they take up half of the labels
+    void ResetLegend() {
+        Legend.Indices.shrink(0);
+        if (Legend.LabelsUnused < 1024 || Legend.LabelsUnused < Legend.Labels.size() / 2)
+            return;
+        ImGuiTextBuffer labels;
+        labels.Buf.reserve(Legend.Labels.size() - Legend.LabelsUnused);
+        for (int i = 0; i < ItemPool.GetBufSize(); ++i) {
+            ImPlotItem* item = ItemPool.GetByIndex(i);
+            if (item->NameOffset != -1) {
+                const char* label = Legend.Labels.Buf.Data + item->NameOffset;
+                item->NameOffset = labels.size();
+                labels.append(label, label + strlen(label) + 1);
+            }
+        }
+        Legend.Labels.Buf.swap(labels.Buf);
+        Legend.LabelsUnused = 0;
+    }
 };
 
 // Holds Plot state information that must persist after EndPlot
@@ -1038,6 +1237,7 @@ struct ImPlotPlot
     bool                 Selecting;
     bool                 Selected;
     bool                 ContextLocked;
+    ImPlotProfile        Profile;  // profile of the last frame the plot was profiled in
 
     ImPlotPlot() {
         Flags             = PreviousFlags = ImPlotFlags_None;
@@ -1132,6 +1332,9 @@ struct ImPlotSubplot {
     ImVector<float>               ColRatios;
     ImVector<ImPlotRange>         RowLinkData;
     ImVector<ImPlotRange>         ColLinkData;
+    ImVector<bool>                CellDirty;                            // see SetSubplotCellDirty
+    int                           CellsReplayed, CellsRebuilt;          // counts for the current frame
+    int                           CellsReplayedPrev, CellsRebuiltPrev;  // counts for the previous frame
     float                         TempSizes[2];
     bool                          FrameHovered;
     bool                          HasTitle;
@@ -1143,6 +1346,7 @@ struct ImPlotSubplot {
         Items.Legend.Location       = ImPlotLocation_North;
         Items.Legend.Flags          = ImPlotLegendFlags_Horizontal|ImPlotLegendFlags_Outside;
         Items.Legend.CanGoInside    = false;
+        CellsReplayed = CellsRebuilt = CellsReplayedPrev = CellsRebuiltPrev = 0;
         TempSizes[0] = TempSizes[1] = 0;
         FrameHovered                = false;
         HasTitle                    = false;
@@ -1190,6 +1394,10 @@ struct ImPlotNextItemData {
     bool            HasHidden;
     bool            Hidden;
     ImPlotCond      HiddenCond;
+    ImPlotItemHandle Handle;       // handle identifying the item (see SetNextItemHandle), or an empty one to use its label
+    ImGuiID         CacheKey;      // hash of the plotter's arguments (see ImPlotItemFlags_CacheVertices), 0 if none
+    const void*     CacheData[4];  // data pointers among the plotter's arguments
+    int             CacheDataCount;
     ImPlotNextItemData() { Reset(); }
     void Reset() {
         for (int i = 0; i < 5; ++i)
@@ -1197,9 +1405,173 @@ struct ImPlotNextItemData {
         LineWeight    = MarkerSize = MarkerWeight = FillAlpha = ErrorBarSize = ErrorBarWeight = DigitalBitHeight = DigitalBitGap = IMPLOT_AUTO;
         Marker        = IMPLOT_AUTO;
         HasHidden     = Hidden = false;
+        Handle        = ImPlotItemHandle();
+        CacheKey      = 0;
+        CacheDataCount = 0;
+    }
+};
+
+// Cached extents of a user data buffer (see ImPlotItemFlags_CacheExtents). The finite values of the buffer
+// are reduced to min/max pairs in blocks, and the blocks are reduced pairwise into a pyramid, so that the
+// extents of the whole buffer are known in O(1) and those of any sub-range can be found in O(log N).
+struct ImPlotDataCache {
+    const void*      Data;
+    int              LastFrame;
+    ImVector<int>    Levels; // offsets of each pyramid level into Mins/Maxs, plus the total size
+    ImVector<double> Mins;
+    ImVector<double> Maxs;
+
+    ImPlotDataCache() { Data = nullptr; LastFrame = -1; }
+
+    // Extends #out with the extents of the blocks [b0,b1) of the lowest pyramid level
+    void QueryBlocks(int b0, int b1, ImPlotRange& out) const {
+        for (int l = 0; b0 < b1 && l < Levels.Size - 1; ++l, b0 >>= 1, b1 >>= 1) {
+            if (b0 & 1) {
+                out.Min = ImMin(out.Min, Mins[Levels[l] + b0]);
+                out.Max = ImMax(out.Max, Maxs[Levels[l] + b0]);
+                ++b0;
+            }
+            if (b1 & 1) {
+                --b1;
+                out.Min = ImMin(out.Min, Mins[Levels[l] + b1]);
+                out.Max = ImMax(out.Max, Maxs[Levels[l] + b1]);
+            }
+        }
+    }
+};
+
+// Font atlas builder hook which packs and rasterizes marker sprites into the atlas (see AddFontAtlasMarkerSprites).
+// IO must remain the first member, as the builder finds its state from the atlas' FontBuilderIO. The hook is heap allocated so that it
+// outlives its context: when the context can't unhook the atlas, it is orphaned and frees itself on the atlas' next build.
+struct ImPlotMarkerSprites {
+    ImFontBuilderIO        IO;       // installed as the atlas' FontBuilderIO
+    const ImFontBuilderIO* BaseIO;   // builder the atlas used before, restored by RemoveFontAtlasMarkerSprites
+    ImFontAtlas*           Atlas;
+    int                    RectId;
+    bool                   Orphaned; // the context was destroyed while the atlas was hooked
+
+    ImPlotMarkerSprites() { IO.FontBuilder_Build = nullptr; BaseIO = nullptr; Atlas = nullptr; RectId = -1; Orphaned = false; }
+};
+
+// Texture of a heatmap plotted with ImPlotHeatmapFlags_Texture
+struct ImPlotHeatmapTexture {
+    ImTextureID Texture;
+    ImGuiID     Key;        // hash of the data pointer, dimensions, scale and colormap of the uploaded pixels, 0 if stale
+    const void* Data;
+    int         LastFrame;
+
+    ImPlotHeatmapTexture() { Texture = 0; Key = 0; Data = nullptr; LastFrame = -1; }
+};
+
+// Indices where the value of a digital signal changes (see ImPlotDigitalFlags_Transitions)
+struct ImPlotDigitalRuns {
+    ImVector<int> Starts;     // index of the first sample of each run (empty for PlotDigitalEdges)
+    double        MaxValue;   // largest value of the signal
+    int           Count;      // number of samples scanned for MaxValue
+    const void*   Data;
+    int           LastFrame;
+
+    ImPlotDigitalRuns() { MaxValue = 0; Count = 0; Data = nullptr; LastFrame = -1; }
+};
+
+// Formatted heatmap label, stored in ImPlotContext::HeatmapLabelText
+struct ImPlotHeatmapLabel {
+    ImU64   Value;  // bits of the labeled value
+    ImGuiID FmtId;  // hash of the format and value type
+    int     TextOffset;
+};
+
+// Retained vertices of an item (see ImPlotItemFlags_CacheVertices). Vertices and indices are stored in segments,
+// one per draw command the item spanned when it was recorded, with indices relative to the segment's first vertex.
+struct ImPlotVertexCache {
+    ImGuiID              Key;
+    int                  LastFrame;
+    const void*          Data[4];
+    int                  DataCount;
+    ImVector<ImDrawVert> Vtx;
+    ImVector<ImDrawIdx>  Idx;
+    ImVector<int>        SegVtxCounts;
+    ImVector<int>        SegIdxCounts;
+
+    ImPlotVertexCache() { Key = 0; LastFrame = -1; DataCount = 0; }
+
+    bool UsesData(const void* data) const {
+        for (int i = 0; i < DataCount; ++i) {
+            if (Data[i] == data)
+                return true;
+        }
+        return false;
+    }
+};
+
+// Point of a spatial index, in the scale space of the item's axes (i.e. after their transforms), where pixel distances are linear
+struct ImPlotSpatialPoint {
+    double X, Y;
+    int    Index;  // index of the point in the item's getter
+};
+
+// Spatial index of the points of an item (see ImPlotItemFlags_SpatialIndex). Points are copied from the item's getter as
+// they are appended, and organized into k-d trees as the index is queried. Trees are stored back to back in Points in
+// decreasing order of size, and pending points are merged with every tree that isn't larger into a new one, so that
+// each point is repartitioned O(log N) times while data is streamed in.
+struct ImPlotSpatialIndex {
+    ImVector<ImPlotSpatialPoint> Points;
+    ImVector<bool>               Split;           // whether the subtree of which each point is the middle has been partitioned
+    ImVector<int>                Trees;           // offset of each tree into Points
+    int                          Built;           // number of points in trees; the others are pending
+    int                          Count;           // number of getter points read, including non-finite ones
+    ImPlotPoint                  First, Last;     // first and last points read, to detect data that wasn't only appended
+    ImAxis                       XAxis, YAxis;
+    ImPlotTransform              TransformX, TransformY;
+    void*                        TransformDataX;
+    void*                        TransformDataY;
+    const void*                  Data[4];
+    int                          DataCount;
+    int                          LastFrame;
+
+    ImPlotSpatialIndex() { Built = Count = 0; XAxis = YAxis = -1; TransformX = TransformY = nullptr; TransformDataX = TransformDataY = nullptr; DataCount = 0; LastFrame = -1; }
+
+    void Reset() {
+        Points.resize(0);
+        Split.resize(0);
+        Trees.resize(0);
+        Built = Count = 0;
+    }
+
+    bool UsesData(const void* data) const {
+        for (int i = 0; i < DataCount; ++i) {
+            if (Data[i] == data)
+                return true;
+        }
+        return false;
     }
 };
 
+// Draw command of a retained subplot cell
+struct ImPlotCellSegment {
+    ImVec4      ClipRect;
+    ImTextureID TextureId;
+    int         VtxCount;
+    int         IdxCount;
+};
+
+// Retained draw data of a subplot cell (see ImPlotSubplotFlags_CacheCells). Like ImPlotVertexCache, indices are
+// relative to the first vertex of their segment. PadH/PadV are the cell's contributions to its row and column alignment.
+struct ImPlotCellCache {
+    ImGuiID                     Key;
+    ImGuiID                     SetupKey;                 // hash of the Setup API inputs of the recorded plot
+    int                         LastFrame;
+    int                         DirtyFrame;               // last frame the cell was rebuilt because it was dirty
+    ImGuiID                     LinkGroups[ImAxis_COUNT]; // axis link groups of the recorded plot
+    float                       PadH[2];
+    float                       PadV[2];
+    ImVector<ImDrawVert>        Vtx;
+    ImVector<ImDrawIdx>         Idx;
+    ImVector<ImPlotCellSegment> Segments;
+
+    ImPlotCellCache() { Key = SetupKey = 0; LastFrame = DirtyFrame = -1; PadH[0] = PadH[1] = PadV[0] = PadV[1] = 0; memset(LinkGroups, 0, sizeof(LinkGroups)); }
+};
+
 // Holds state information that must persist between calls to BeginPlot()/EndPlot()
 struct ImPlotContext {
     // Plot States
@@ -1227,10 +1599,77 @@ struct ImPlotContext {
 
     // Time
     tm Tm;
+    ImPool<ImPlotTzSpan>         TzSpans;     // local time UTC offsets of the spans of time converted so far
+    int                          TzLastSpan;  // index of the span used last, checked before looking it up
 
     // Temp data for general use
-    ImVector<double>   TempDouble1, TempDouble2;
-    ImVector<int>      TempInt1;
+    ImVector<double>      TempDouble1, TempDouble2;
+    ImVector<int>         TempInt1;
+    ImVector<ImPlotPoint> TempPoint1;
+
+    // Data extents cache
+    ImPool<ImPlotDataCache> DataCache;
+    int                     DataCacheFrame;
+
+    // Item vertex cache
+    ImPool<ImPlotVertexCache> VertexCache;
+    ImPlotVertexCache*        CurrentVertexCache;  // cache being recorded by the current item
+    ImGuiID                   CurrentVertexCacheKey;
+    int                       VertexCacheVtxStart, VertexCacheIdxStart, VertexCacheCmdStart;
+    int                       VertexCacheFrame;
+
+    // Subplot cell cache
+    ImPool<ImPlotCellCache> CellCache;
+    ImPlotCellCache*        CurrentCellCache;  // cache being recorded by the current plot
+    ImGuiID                 CurrentCellCacheKey;
+    int                     CellCacheVtxStart, CellCacheIdxStart, CellCacheCmdStart;
+    int                     CellCacheFrame;
+    ImGuiID                 CurrentCellSetupKey;
+    bool                    CellReplayed;         // the current plot replayed its cell, so its items and rendering are skipped
+    ImDrawList*             CellReplayDrawList;   // window draw list, replaced by CellScratchDrawList while CellReplayed
+    ImDrawList*             CellScratchDrawList;  // receives and discards what is drawn to replayed cells
+
+    // Marker sprites
+    ImPlotMarkerSprites* MarkerSprites;  // nullptr unless AddFontAtlasMarkerSprites was called
+
+    // Heatmap label cache
+    ImGuiStorage                 HeatmapLabelMap;   // hash of value and format -> index into HeatmapLabels
+    ImVector<ImPlotHeatmapLabel> HeatmapLabels;
+    ImVector<char>               HeatmapLabelText;
+
+    // Heatmap textures
+    ImPool<ImPlotHeatmapTexture> HeatmapTextures;
+    int                          HeatmapTexturesFrame;
+    ImVector<ImU32>              HeatmapPixels;
+    ImVector<ImU32>              HeatmapColors;
+    ImPlotTextureUpdate          TextureUpdate;
+    ImPlotTextureDestroy         TextureDestroy;
+    void*                        TextureUserData;
+
+    // Digital run indices
+    ImPool<ImPlotDigitalRuns> DigitalRuns;
+    int                       DigitalRunsFrame;
+
+    // Item spatial indices
+    ImPool<ImPlotSpatialIndex> SpatialIndices;
+    int                        SpatialIndicesFrame;
+
+    // Profiler
+    bool             ProfilerEnabled;
+    bool             ProfilerOverlay;
+    ImPlotProfile    PlotProfile;        // profile of the current plot, being recorded
+    ImPlotProfile    ItemProfile;        // profile of the current item, being recorded
+    double           PlotProfileStart, ItemProfileStart;
+    int              PlotProfileVtxStart, PlotProfileIdxStart;
+    int              ItemProfileVtxStart, ItemProfileIdxStart;
+    ImPlotCacheStats CacheStats;         // counts for the current frame
+    ImPlotCacheStats CacheStatsPrev;     // counts for the previous frame
+    int              CacheStatsFrame;
+
+    // Parallel rendering
+    ImPlotParallelFor ParallelFor;
+    void*             ParallelForData;
+    int               ParallelMinPrims;
 
     // Misc
     int                DigitalPlotItemCnt;
@@ -1242,6 +1681,9 @@ struct ImPlotContext {
     ImGuiTextBuffer    MousePosStringBuilder;
     ImPlotItemGroup*   SortItems;
 
+    // Axis link groups
+    ImPool<ImPlotAxisLinkGroup> AxisLinkGroups;
+
     // Align plots
     ImPool<ImPlotAlignmentData> AlignmentData;
     ImPlotAlignmentData*        CurrentAlignmentH;
@@ -1282,6 +1724,25 @@ IMPLOT_API void BustPlotCache();
 // Shows a plot's context menu.
 IMPLOT_API void ShowPlotContextMenu(ImPlotPlot& plot);
 
+//-----------------------------------------------------------------------------
+// [SECTION] Profiler Utils
+//-----------------------------------------------------------------------------
+
+// Returns the time in milliseconds of a monotonic clock, for timing with the profiler.
+IMPLOT_API double GetProfilerTime();
+
+// Gets the cache statistics of the current frame, moving those of the previous frame to CacheStatsPrev on its first call in a frame.
+static inline ImPlotCacheStats& GetFrameCacheStats() {
+    ImPlotContext& gp = *GImPlot;
+    const int frame = ImGui::GetFrameCount();
+    if (gp.CacheStatsFrame != frame) {
+        gp.CacheStatsPrev  = gp.CacheStatsFrame == frame - 1 ? gp.CacheStats : ImPlotCacheStats();
+        gp.CacheStats      = ImPlotCacheStats();
+        gp.CacheStatsFrame = frame;
+    }
+    return gp.CacheStats;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Setup Utils
 //-----------------------------------------------------------------------------
@@ -1311,21 +1772,40 @@ IMPLOT_API void ShowSubplotsContextMenu(ImPlotSubplot& subplot);
 // Begins a new item. Returns false if the item should not be plotted. Pushes PlotClipRect.
 IMPLOT_API bool BeginItem(const char* label_id, ImPlotItemFlags flags=0, ImPlotCol recolor_from=IMPLOT_AUTO);
 
-// Same as above but with fitting functionality.
+// Ends an item (call only if BeginItem returns true). Pops PlotClipRect.
+IMPLOT_API void EndItem();
+
+// Replays the retained vertices of the current item and returns true if its cache key (see SetItemCacheKey) is unchanged.
+// Otherwise, starts recording the vertices it renders until EndItem and returns false.
+IMPLOT_API bool BeginItemVertexCache();
+
+// Reads the points appended to the current item's data into its spatial index (see ImPlotItemFlags_SpatialIndex). Items
+// are indexed from the getter of their fitter, so only those fitted from a single getter are; this overload is for the others.
+template <typename _Fitter>
+void UpdateSpatialIndex(const _Fitter&) { }
+
+// Same as BeginItem but with fitting functionality, spatial indexing, and replay of retained vertices (see ImPlotItemFlags_CacheVertices).
 template <typename _Fitter>
 bool BeginItemEx(const char* label_id, const _Fitter& fitter, ImPlotItemFlags flags=0, ImPlotCol recolor_from=IMPLOT_AUTO) {
     if (BeginItem(label_id, flags, recolor_from)) {
         ImPlotPlot& plot = *GetCurrentPlot();
-        if (plot.FitThisFrame && !ImHasFlag(flags, ImPlotItemFlags_NoFit))
+        if (plot.FitThisFrame && !ImHasFlag(flags, ImPlotItemFlags_NoFit)) {
+            const double t0 = GImPlot->ProfilerEnabled ? GetProfilerTime() : 0;
             fitter.Fit(plot.Axes[plot.CurrentX], plot.Axes[plot.CurrentY]);
+            if (GImPlot->ProfilerEnabled)
+                GImPlot->ItemProfile.FitTime += GetProfilerTime() - t0;
+        }
+        if (ImHasFlag(flags, ImPlotItemFlags_SpatialIndex))
+            UpdateSpatialIndex(fitter);
+        if (ImHasFlag(flags, ImPlotItemFlags_CacheVertices) && BeginItemVertexCache()) {
+            EndItem();
+            return false;
+        }
         return true;
     }
     return false;
 }
 
-// Ends an item (call only if BeginItem returns true). Pops PlotClipRect.
-IMPLOT_API void EndItem();
-
 // Register or get an existing item from the current plot.
 IMPLOT_API ImPlotItem* RegisterOrGetItem(const char* label_id, ImPlotItemFlags flags, bool* just_created = nullptr);
 // Get a plot item from the current plot.
@@ -1560,6 +2040,8 @@ IMPLOT_API tm* GetGmtTime(const ImPlotTime& t, tm* ptm);
 IMPLOT_API ImPlotTime MkLocTime(struct tm *ptm);
 // Make a tm struct expressed in local time from a UNIX timestamp.
 IMPLOT_API tm* GetLocTime(const ImPlotTime& t, tm* ptm);
+// Clears the local time UTC offsets cached in the current context by MkLocTime and GetLocTime. Call this if the process time zone changes.
+IMPLOT_API void BustLocalTimeCache();
 
 // NB: The following functions only work if there is a current ImPlotContext because the
 // internal tm struct is owned by the context! They are aware of ImPlotStyle.UseLocalTime.
@@ -104,6 +104,556 @@ static IMPLOT_INLINE float  ImInvSqrt(float x) { return 1.0f / sqrtf(x); }
 #define _INSTANTIATE_FOR_NUMERIC_TYPES_2_END
 #define CALL_INSTANTIATE_FOR_NUMERIC_TYPES() _INSTANTIATE_FOR_NUMERIC_TYPES(IMPLOT_NUMERIC_TYPES)
 
+//-----------------------------------------------------------------------------
+// [SECTION] SIMD Array Helpers
+//-----------------------------------------------------------------------------
+
+// Vectorized versions of ImMinMaxArray, ImMean, ImStdDev and ImPlot::ColormapMapValues for float, double, ImS32, ImU8
+// and ImU16. SSE2 (x86) and NEON (AArch64) kernels are selected at compile time, and AVX2 kernels are selected at
+// runtime if the CPU supports them. Define IMPLOT_DISABLE_SIMD to always use the generic versions.
+
+#ifndef IMPLOT_DISABLE_SIMD
+    #if defined __SSE2__ || defined _M_X64 || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+        #include <immintrin.h>
+        #define IMPLOT_SIMD_SSE2
+        #if defined __GNUC__ || defined __clang__
+            #define IMPLOT_SIMD_AVX2
+            #define IMPLOT_TARGET_AVX2 __attribute__((target("avx2")))
+        #elif defined _MSC_VER
+            #include <intrin.h>
+            #define IMPLOT_SIMD_AVX2
+            #define IMPLOT_TARGET_AVX2
+        #endif
+    #elif defined __aarch64__ && defined __ARM_NEON
+        #include <arm_neon.h>
+        #define IMPLOT_SIMD_NEON
+    #endif
+#endif
+
+// Arrays shorter than this aren't worth vectorizing
+static const int SIMD_MIN_COUNT = 32;
+
+enum ImPlotSimdLevel_ {
+    ImPlotSimdLevel_None = 0,
+    ImPlotSimdLevel_SSE2,
+    ImPlotSimdLevel_AVX2,
+    ImPlotSimdLevel_NEON
+};
+
+static int DetectSimdLevel() {
+#if defined IMPLOT_SIMD_AVX2 && (defined __GNUC__ || defined __clang__)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return ImPlotSimdLevel_AVX2;
+#elif defined IMPLOT_SIMD_AVX2
+    // AVX2 requires CPU support (CPUID.7:EBX[5]) and OS support for saving YMM registers (OSXSAVE and XCR0[2:1])
+    int info[4];
+    __cpuid(info, 1);
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    const bool avx     = (info[2] & (1 << 28)) != 0;
+    if (osxsave && avx && (_xgetbv(0) & 6) == 6) {
+        __cpuidex(info, 7, 0);
+        if ((info[1] & (1 << 5)) != 0)
+            return ImPlotSimdLevel_AVX2;
+    }
+#endif
+#if defined IMPLOT_SIMD_SSE2
+    return ImPlotSimdLevel_SSE2;
+#elif defined IMPLOT_SIMD_NEON
+    return ImPlotSimdLevel_NEON;
+#else
+    return ImPlotSimdLevel_None;
+#endif
+}
+
+static inline int GetSimdLevel() {
+    static const int level = DetectSimdLevel();
+    return level;
+}
+
+const char* ImSimdInstructionSet() {
+    switch (GetSimdLevel()) {
+        case ImPlotSimdLevel_SSE2: return "SSE2";
+        case ImPlotSimdLevel_AVX2: return "AVX2";
+        case ImPlotSimdLevel_NEON: return "NEON";
+        default:                   return "None";
+    }
+}
+
+// Reduces the lanes of vectorized min/max accumulators and the remaining tail of the array
+template <typename T>
+static inline void ReduceMinMax(const T* mins, const T* maxs, int lanes, const T* tail, int tail_count, T* min_out, T* max_out) {
+    T Min = mins[0]; T Max = maxs[0];
+    for (int i = 1; i < lanes; ++i) {
+        if (mins[i] < Min) { Min = mins[i]; }
+        if (maxs[i] > Max) { Max = maxs[i]; }
+    }
+    for (int i = 0; i < tail_count; ++i) {
+        if (tail[i] < Min) { Min = tail[i]; }
+        if (tail[i] > Max) { Max = tail[i]; }
+    }
+    *min_out = Min; *max_out = Max;
+}
+
+#ifdef IMPLOT_SIMD_SSE2
+
+// Note: _mm_min_ps/_mm_max_ps return their second operand if either is NaN, so NaNs are skipped
+// exactly like they are by the generic version as long as the accumulator comes second.
+struct SimdSSE2F32 {
+    typedef float T; typedef __m128 V; enum { N = 4 };
+    static inline V    Load(const T* p)     { return _mm_loadu_ps(p); }
+    static inline V    Set1(T x)            { return _mm_set1_ps(x); }
+    static inline V    Min(V a, V b)        { return _mm_min_ps(a, b); }
+    static inline V    Max(V a, V b)        { return _mm_max_ps(a, b); }
+    static inline void Store(T* p, V v)     { _mm_storeu_ps(p, v); }
+};
+
+struct SimdSSE2F64 {
+    typedef double T; typedef __m128d V; enum { N = 2 };
+    static inline V    Load(const T* p)     { return _mm_loadu_pd(p); }
+    static inline V    Set1(T x)            { return _mm_set1_pd(x); }
+    static inline V    Min(V a, V b)        { return _mm_min_pd(a, b); }
+    static inline V    Max(V a, V b)        { return _mm_max_pd(a, b); }
+    static inline void Store(T* p, V v)     { _mm_storeu_pd(p, v); }
+};
+
+// SSE2 has no 32-bit integer min/max, so they are emulated with compares
+struct SimdSSE2S32 {
+    typedef ImS32 T; typedef __m128i V; enum { N = 4 };
+    static inline V    Load(const T* p)     { return _mm_loadu_si128((const __m128i*)p); }
+    static inline V    Set1(T x)            { return _mm_set1_epi32(x); }
+    static inline V    Min(V a, V b)        { const V m = _mm_cmpgt_epi32(b, a); return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)); }
+    static inline V    Max(V a, V b)        { const V m = _mm_cmpgt_epi32(a, b); return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b)); }
+    static inline void Store(T* p, V v)     { _mm_storeu_si128((__m128i*)p, v); }
+};
+
+struct SimdSSE2U8 {
+    typedef ImU8 T; typedef __m128i V; enum { N = 16 };
+    static inline V    Load(const T* p)     { return _mm_loadu_si128((const __m128i*)p); }
+    static inline V    Set1(T x)            { return _mm_set1_epi8((char)x); }
+    static inline V    Min(V a, V b)        { return _mm_min_epu8(a, b); }
+    static inline V    Max(V a, V b)        { return _mm_max_epu8(a, b); }
+    static inline void Store(T* p, V v)     { _mm_storeu_si128((__m128i*)p, v); }
+};
+
+// SSE2 has no unsigned 16-bit min/max, so values are biased into the signed range while in registers
+struct SimdSSE2U16 {
+    typedef ImU16 T; typedef __m128i V; enum { N = 8 };
+    static inline V    Bias(V v)            { return _mm_xor_si128(v, _mm_set1_epi16((short)0x8000)); }
+    static inline V    Load(const T* p)     { return Bias(_mm_loadu_si128((const __m128i*)p)); }
+    static inline V    Set1(T x)            { return Bias(_mm_set1_epi16((short)x)); }
+    static inline V    Min(V a, V b)        { return _mm_min_epi16(a, b); }
+    static inline V    Max(V a, V b)        { return _mm_max_epi16(a, b); }
+    static inline void Store(T* p, V v)     { _mm_storeu_si128((__m128i*)p, Bias(v)); }
+};
+
+// Loads four values as two pairs of doubles
+static inline void LoadPD_SSE2(const float*  p, __m128d& lo, __m128d& hi) { const __m128 x = _mm_loadu_ps(p); lo = _mm_cvtps_pd(x); hi = _mm_cvtps_pd(_mm_movehl_ps(x, x)); }
+static inline void LoadPD_SSE2(const double* p, __m128d& lo, __m128d& hi) { lo = _mm_loadu_pd(p); hi = _mm_loadu_pd(p + 2); }
+static inline void LoadPD_SSE2(__m128i x,       __m128d& lo, __m128d& hi) { lo = _mm_cvtepi32_pd(x); hi = _mm_cvtepi32_pd(_mm_shuffle_epi32(x, _MM_SHUFFLE(1,0,3,2))); }
+static inline void LoadPD_SSE2(const ImS32*  p, __m128d& lo, __m128d& hi) { LoadPD_SSE2(_mm_loadu_si128((const __m128i*)p), lo, hi); }
+static inline void LoadPD_SSE2(const ImU16*  p, __m128d& lo, __m128d& hi) { LoadPD_SSE2(_mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i*)p), _mm_setzero_si128()), lo, hi); }
+static inline void LoadPD_SSE2(const ImU8*   p, __m128d& lo, __m128d& hi) {
+    int x; memcpy(&x, p, sizeof(x));
+    LoadPD_SSE2(_mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(x), _mm_setzero_si128()), _mm_setzero_si128()), lo, hi);
+}
+
+template <typename Ops>
+static void MinMaxSSE2(const typename Ops::T* values, int count, typename Ops::T* min_out, typename Ops::T* max_out) {
+    typedef typename Ops::T T;
+    typename Ops::V vmin = Ops::Set1(values[0]), vmax = vmin;
+    int i = 0;
+    for (; i + Ops::N <= count; i += Ops::N) {
+        const typename Ops::V v = Ops::Load(values + i);
+        vmin = Ops::Min(v, vmin);
+        vmax = Ops::Max(v, vmax);
+    }
+    T mins[Ops::N], maxs[Ops::N];
+    Ops::Store(mins, vmin);
+    Ops::Store(maxs, vmax);
+    ReduceMinMax(mins, maxs, Ops::N, values + i, count - i, min_out, max_out);
+}
+
+// Finds the sum of the values, or the sum of their squared deviations from #mu if #sq is true
+template <typename T>
+static double SumSSE2(const T* values, int count, bool sq, double mu) {
+    const __m128d vmu = _mm_set1_pd(mu);
+    __m128d acc0 = _mm_setzero_pd(), acc1 = _mm_setzero_pd();
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128d lo, hi;
+        LoadPD_SSE2(values + i, lo, hi);
+        if (sq) {
+            lo = _mm_sub_pd(lo, vmu);
+            hi = _mm_sub_pd(hi, vmu);
+            lo = _mm_mul_pd(lo, lo);
+            hi = _mm_mul_pd(hi, hi);
+        }
+        acc0 = _mm_add_pd(acc0, lo);
+        acc1 = _mm_add_pd(acc1, hi);
+    }
+    double lanes[2];
+    _mm_storeu_pd(lanes, _mm_add_pd(acc0, acc1));
+    double sum = lanes[0] + lanes[1];
+    for (; i < count; ++i)
+        sum += sq ? ((double)values[i] - mu) * ((double)values[i] - mu) : (double)values[i];
+    return sum;
+}
+
+// Maps values to colormap table entries (see ImPlot::ColormapMapValues) and returns the number of values mapped. Note:
+// _mm_max_ps returns its second operand if either is NaN, so NaNs are mapped to 0.
+template <typename T>
+static int ColormapSSE2(const T* values, int count, double x0, double x1, const ImU32* table, float mul, float add, float lim, ImU32* out) {
+    const __m128d vx0 = _mm_set1_pd(x0), vdx = _mm_set1_pd(x1 - x0);
+    const __m128 vmul = _mm_set1_ps(mul), vadd = _mm_set1_ps(add), vlim = _mm_set1_ps(lim), zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        __m128d lo, hi;
+        LoadPD_SSE2(values + i, lo, hi);
+        lo = _mm_div_pd(_mm_sub_pd(lo, vx0), vdx);
+        hi = _mm_div_pd(_mm_sub_pd(hi, vx0), vdx);
+        __m128 t = _mm_movelh_ps(_mm_cvtpd_ps(lo), _mm_cvtpd_ps(hi));
+        t = _mm_min_ps(_mm_max_ps(t, zero), one);
+        int idx[4];
+        _mm_storeu_si128((__m128i*)idx, _mm_cvttps_epi32(_mm_min_ps(_mm_add_ps(_mm_mul_ps(t, vmul), vadd), vlim)));
+        out[i+0] = table[idx[0]];
+        out[i+1] = table[idx[1]];
+        out[i+2] = table[idx[2]];
+        out[i+3] = table[idx[3]];
+    }
+    return i;
+}
+
+#endif // IMPLOT_SIMD_SSE2
+
+#ifdef IMPLOT_SIMD_AVX2
+
+struct SimdAVX2F32 {
+    typedef float T; typedef __m256 V; enum { N = 8 };
+    static IMPLOT_TARGET_AVX2 inline V    Load(const T* p)  { return _mm256_loadu_ps(p); }
+    static IMPLOT_TARGET_AVX2 inline V    Set1(T x)         { return _mm256_set1_ps(x); }
+    static IMPLOT_TARGET_AVX2 inline V    Min(V a, V b)     { return _mm256_min_ps(a, b); }
+    static IMPLOT_TARGET_AVX2 inline V    Max(V a, V b)     { return _mm256_max_ps(a, b); }
+    static IMPLOT_TARGET_AVX2 inline void Store(T* p, V v)  { _mm256_storeu_ps(p, v); }
+};
+
+struct SimdAVX2F64 {
+    typedef double T; typedef __m256d V; enum { N = 4 };
+    static IMPLOT_TARGET_AVX2 inline V    Load(const T* p)  { return _mm256_loadu_pd(p); }
+    static IMPLOT_TARGET_AVX2 inline V    Set1(T x)         { return _mm256_set1_pd(x); }
+    static IMPLOT_TARGET_AVX2 inline V    Min(V a, V b)     { return _mm256_min_pd(a, b); }
+    static IMPLOT_TARGET_AVX2 inline V    Max(V a, V b)     { return _mm256_max_pd(a, b); }
+    static IMPLOT_TARGET_AVX2 inline void Store(T* p, V v)  { _mm256_storeu_pd(p, v); }
+};
+
+struct SimdAVX2S32 {
+    typedef ImS32 T; typedef __m256i V; enum { N = 8 };
+    static IMPLOT_TARGET_AVX2 inline V    Load(const T* p)  { return _mm256_loadu_si256((const __m256i*)p); }
+    static IMPLOT_TARGET_AVX2 inline V    Set1(T x)         { return _mm256_set1_epi32(x); }
+    static IMPLOT_TARGET_AVX2 inline V    Min(V a, V b)     { return _mm256_min_epi32(a, b); }
+    static IMPLOT_TARGET_AVX2 inline V    Max(V a, V b)     { return _mm256_max_epi32(a, b); }
+    static IMPLOT_TARGET_AVX2 inline void Store(T* p, V v)  { _mm256_storeu_si256((__m256i*)p, v); }
+};
+
+struct SimdAVX2U8 {
+    typedef ImU8 T; typedef __m256i V; enum { N = 32 };
+    static IMPLOT_TARGET_AVX2 inline V    Load(const T* p)  { return _mm256_loadu_si256((const __m256i*)p); }
+    static IMPLOT_TARGET_AVX2 inline V    Set1(T x)         { return _mm256_set1_epi8((char)x); }
+    static IMPLOT_TARGET_AVX2 inline V    Min(V a, V b)     { return _mm256_min_epu8(a, b); }
+    static IMPLOT_TARGET_AVX2 inline V    Max(V a, V b)     { return _mm256_max_epu8(a, b); }
+    static IMPLOT_TARGET_AVX2 inline void Store(T* p, V v)  { _mm256_storeu_si256((__m256i*)p, v); }
+};
+
+struct SimdAVX2U16 {
+    typedef ImU16 T; typedef __m256i V; enum { N = 16 };
+    static IMPLOT_TARGET_AVX2 inline V    Load(const T* p)  { return _mm256_loadu_si256((const __m256i*)p); }
+    static IMPLOT_TARGET_AVX2 inline V    Set1(T x)         { return _mm256_set1_epi16((short)x); }
+    static IMPLOT_TARGET_AVX2 inline V    Min(V a, V b)     { return _mm256_min_epu16(a, b); }
+    static IMPLOT_TARGET_AVX2 inline V    Max(V a, V b)     { return _mm256_max_epu16(a, b); }
+    static IMPLOT_TARGET_AVX2 inline void Store(T* p, V v)  { _mm256_storeu_si256((__m256i*)p, v); }
+};
+
+// Loads four values as doubles
+static IMPLOT_TARGET_AVX2 inline __m256d LoadPD_AVX2(const float*  p) { return _mm256_cvtps_pd(_mm_loadu_ps(p)); }
+static IMPLOT_TARGET_AVX2 inline __m256d LoadPD_AVX2(const double* p) { return _mm256_loadu_pd(p); }
+static IMPLOT_TARGET_AVX2 inline __m256d LoadPD_AVX2(const ImS32*  p) { return _mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i*)p)); }
+static IMPLOT_TARGET_AVX2 inline __m256d LoadPD_AVX2(const ImU16*  p) { return _mm256_cvtepi32_pd(_mm_cvtepu16_epi32(_mm_loadl_epi64((const __m128i*)p))); }
+static IMPLOT_TARGET_AVX2 inline __m256d LoadPD_AVX2(const ImU8*   p) { int x; memcpy(&x, p, sizeof(x)); return _mm256_cvtepi32_pd(_mm_cvtepu8_epi32(_mm_cvtsi32_si128(x))); }
+
+template <typename Ops>
+static IMPLOT_TARGET_AVX2 void MinMaxAVX2(const typename Ops::T* values, int count, typename Ops::T* min_out, typename Ops::T* max_out) {
+    typedef typename Ops::T T;
+    typename Ops::V vmin = Ops::Set1(values[0]), vmax = vmin;
+    int i = 0;
+    for (; i + Ops::N <= count; i += Ops::N) {
+        const typename Ops::V v = Ops::Load(values + i);
+        vmin = Ops::Min(v, vmin);
+        vmax = Ops::Max(v, vmax);
+    }
+    T mins[Ops::N], maxs[Ops::N];
+    Ops::Store(mins, vmin);
+    Ops::Store(maxs, vmax);
+    ReduceMinMax(mins, maxs, Ops::N, values + i, count - i, min_out, max_out);
+}
+
+template <typename T>
+static IMPLOT_TARGET_AVX2 double SumAVX2(const T* values, int count, bool sq, double mu) {
+    const __m256d vmu = _mm256_set1_pd(mu);
+    __m256d acc0 = _mm256_setzero_pd(), acc1 = _mm256_setzero_pd();
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        __m256d a = LoadPD_AVX2(values + i);
+        __m256d b = LoadPD_AVX2(values + i + 4);
+        if (sq) {
+            a = _mm256_sub_pd(a, vmu);
+            b = _mm256_sub_pd(b, vmu);
+            a = _mm256_mul_pd(a, a);
+            b = _mm256_mul_pd(b, b);
+        }
+        acc0 = _mm256_add_pd(acc0, a);
+        acc1 = _mm256_add_pd(acc1, b);
+    }
+    double lanes[4];
+    _mm256_storeu_pd(lanes, _mm256_add_pd(acc0, acc1));
+    double sum = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+    for (; i < count; ++i)
+        sum += sq ? ((double)values[i] - mu) * ((double)values[i] - mu) : (double)values[i];
+    return sum;
+}
+
+template <typename T>
+static IMPLOT_TARGET_AVX2 int ColormapAVX2(const T* values, int count, double x0, double x1, const ImU32* table, float mul, float add, float lim, ImU32* out) {
+    const __m256d vx0 = _mm256_set1_pd(x0), vdx = _mm256_set1_pd(x1 - x0);
+    const __m256 vmul = _mm256_set1_ps(mul), vadd = _mm256_set1_ps(add), vlim = _mm256_set1_ps(lim), zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f);
+    int i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256d a = _mm256_div_pd(_mm256_sub_pd(LoadPD_AVX2(values + i), vx0), vdx);
+        const __m256d b = _mm256_div_pd(_mm256_sub_pd(LoadPD_AVX2(values + i + 4), vx0), vdx);
+        __m256 t = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm256_cvtpd_ps(a)), _mm256_cvtpd_ps(b), 1);
+        t = _mm256_min_ps(_mm256_max_ps(t, zero), one);
+        const __m256i idx = _mm256_cvttps_epi32(_mm256_min_ps(_mm256_add_ps(_mm256_mul_ps(t, vmul), vadd), vlim));
+        _mm256_storeu_si256((__m256i*)(out + i), _mm256_i32gather_epi32((const int*)table, idx, 4));
+    }
+    return i;
+}
+
+#endif // IMPLOT_SIMD_AVX2
+
+#ifdef IMPLOT_SIMD_NEON
+
+// Note: vminnmq/vmaxnmq return the numeric operand if the other is NaN, so NaNs are skipped (see dispatch below)
+struct SimdNEONF32 {
+    typedef float T; typedef float32x4_t V; enum { N = 4 };
+    static inline V    Load(const T* p)     { return vld1q_f32(p); }
+    static inline V    Set1(T x)            { return vdupq_n_f32(x); }
+    static inline V    Min(V a, V b)        { return vminnmq_f32(a, b); }
+    static inline V    Max(V a, V b)        { return vmaxnmq_f32(a, b); }
+    static inline void Store(T* p, V v)     { vst1q_f32(p, v); }
+};
+
+struct SimdNEONF64 {
+    typedef double T; typedef float64x2_t V; enum { N = 2 };
+    static inline V    Load(const T* p)     { return vld1q_f64(p); }
+    static inline V    Set1(T x)            { return vdupq_n_f64(x); }
+    static inline V    Min(V a, V b)        { return vminnmq_f64(a, b); }
+    static inline V    Max(V a, V b)        { return vmaxnmq_f64(a, b); }
+    static inline void Store(T* p, V v)     { vst1q_f64(p, v); }
+};
+
+struct SimdNEONS32 {
+    typedef ImS32 T; typedef int32x4_t V; enum { N = 4 };
+    static inline V    Load(const T* p)     { return vld1q_s32(p); }
+    static inline V    Set1(T x)            { return vdupq_n_s32(x); }
+    static inline V    Min(V a, V b)        { return vminq_s32(a, b); }
+    static inline V    Max(V a, V b)        { return vmaxq_s32(a, b); }
+    static inline void Store(T* p, V v)     { vst1q_s32(p, v); }
+};
+
+struct SimdNEONU8 {
+    typedef ImU8 T; typedef uint8x16_t V; enum { N = 16 };
+    static inline V    Load(const T* p)     { return vld1q_u8(p); }
+    static inline V    Set1(T x)            { return vdupq_n_u8(x); }
+    static inline V    Min(V a, V b)        { return vminq_u8(a, b); }
+    static inline V    Max(V a, V b)        { return vmaxq_u8(a, b); }
+    static inline void Store(T* p, V v)     { vst1q_u8(p, v); }
+};
+
+struct SimdNEONU16 {
+    typedef ImU16 T; typedef uint16x8_t V; enum { N = 8 };
+    static inline V    Load(const T* p)     { return vld1q_u16(p); }
+    static inline V    Set1(T x)            { return vdupq_n_u16(x); }
+    static inline V    Min(V a, V b)        { return vminq_u16(a, b); }
+    static inline V    Max(V a, V b)        { return vmaxq_u16(a, b); }
+    static inline void Store(T* p, V v)     { vst1q_u16(p, v); }
+};
+
+// Loads two values as doubles
+static inline float64x2_t LoadPD_NEON(const float*  p) { return vcvt_f64_f32(vld1_f32(p)); }
+static inline float64x2_t LoadPD_NEON(const double* p) { return vld1q_f64(p); }
+static inline float64x2_t LoadPD_NEON(const ImS32*  p) { return vcvtq_f64_s64(vmovl_s32(vld1_s32(p))); }
+static inline float64x2_t LoadPD_NEON(const ImU16*  p) { const double d[2] = { (double)p[0], (double)p[1] }; return vld1q_f64(d); }
+static inline float64x2_t LoadPD_NEON(const ImU8*   p) { const double d[2] = { (double)p[0], (double)p[1] }; return vld1q_f64(d); }
+
+template <typename Ops>
+static void MinMaxNEON(const typename Ops::T* values, int count, typename Ops::T* min_out, typename Ops::T* max_out) {
+    typedef typename Ops::T T;
+    typename Ops::V vmin = Ops::Set1(values[0]), vmax = vmin;
+    int i = 0;
+    for (; i + Ops::N <= count; i += Ops::N) {
+        const typename Ops::V v = Ops::Load(values + i);
+        vmin = Ops::Min(v, vmin);
+        vmax = Ops::Max(v, vmax);
+    }
+    T mins[Ops::N], maxs[Ops::N];
+    Ops::Store(mins, vmin);
+    Ops::Store(maxs, vmax);
+    ReduceMinMax(mins, maxs, Ops::N, values + i, count - i, min_out, max_out);
+}
+
+template <typename T>
+static double SumNEON(const T* values, int count, bool sq, double mu) {
+    const float64x2_t vmu = vdupq_n_f64(mu);
+    float64x2_t acc0 = vdupq_n_f64(0), acc1 = vdupq_n_f64(0);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        float64x2_t a = LoadPD_NEON(values + i);
+        float64x2_t b = LoadPD_NEON(values + i + 2);
+        if (sq) {
+            a = vsubq_f64(a, vmu);
+            b = vsubq_f64(b, vmu);
+            a = vmulq_f64(a, a);
+            b = vmulq_f64(b, b);
+        }
+        acc0 = vaddq_f64(acc0, a);
+        acc1 = vaddq_f64(acc1, b);
+    }
+    double sum = vaddvq_f64(vaddq_f64(acc0, acc1));
+    for (; i < count; ++i)
+        sum += sq ? ((double)values[i] - mu) * ((double)values[i] - mu) : (double)values[i];
+    return sum;
+}
+
+// Note: vmaxnmq returns the numeric operand if the other is NaN, so NaNs are mapped to 0
+template <typename T>
+static int ColormapNEON(const T* values, int count, double x0, double x1, const ImU32* table, float mul, float add, float lim, ImU32* out) {
+    const float64x2_t vx0 = vdupq_n_f64(x0), vdx = vdupq_n_f64(x1 - x0);
+    const float32x4_t vmul = vdupq_n_f32(mul), vadd = vdupq_n_f32(add), vlim = vdupq_n_f32(lim), zero = vdupq_n_f32(0), one = vdupq_n_f32(1);
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float64x2_t a = vdivq_f64(vsubq_f64(LoadPD_NEON(values + i), vx0), vdx);
+        const float64x2_t b = vdivq_f64(vsubq_f64(LoadPD_NEON(values + i + 2), vx0), vdx);
+        float32x4_t t = vcombine_f32(vcvt_f32_f64(a), vcvt_f32_f64(b));
+        t = vminq_f32(vmaxnmq_f32(t, zero), one);
+        int idx[4];
+        vst1q_s32(idx, vcvtq_s32_f32(vminq_f32(vaddq_f32(vmulq_f32(t, vmul), vadd), vlim)));
+        out[i+0] = table[idx[0]];
+        out[i+1] = table[idx[1]];
+        out[i+2] = table[idx[2]];
+        out[i+3] = table[idx[3]];
+    }
+    return i;
+}
+
+#endif // IMPLOT_SIMD_NEON
+
+// Selects the best kernel for the current CPU. A NaN in the first element makes the generic version return NaN,
+// which the kernels (seeded from the first element) would only partially reproduce, so those arrays are left to it.
+#define IMPLOT_SIMD_DEFINE_MINMAX(T, NAME)                                                          \
+    void ImMinMaxArray(const T* values, int count, T* min_out, T* max_out) {                        \
+        if (count >= SIMD_MIN_COUNT && !(values[0] != values[0])) {                                 \
+            switch (GetSimdLevel()) {                                                               \
+                IMPLOT_SIMD_CASE_AVX2(MinMaxAVX2<SimdAVX2##NAME>(values, count, min_out, max_out))  \
+                IMPLOT_SIMD_CASE_SSE2(MinMaxSSE2<SimdSSE2##NAME>(values, count, min_out, max_out))  \
+                IMPLOT_SIMD_CASE_NEON(MinMaxNEON<SimdNEON##NAME>(values, count, min_out, max_out))  \
+                default: break;                                                                     \
+            }                                                                                       \
+        }                                                                                           \
+        ImMinMaxArray<T>(values, count, min_out, max_out);                                          \
+    }
+
+#define IMPLOT_SIMD_DEFINE_STATS(T)                                                                 \
+    static double ImSumSimd(const T* values, int count, bool sq, double mu) {                       \
+        switch (GetSimdLevel()) {                                                                   \
+            IMPLOT_SIMD_CASE_AVX2(SumAVX2(values, count, sq, mu))                                   \
+            IMPLOT_SIMD_CASE_SSE2(SumSSE2(values, count, sq, mu))                                   \
+            IMPLOT_SIMD_CASE_NEON(SumNEON(values, count, sq, mu))                                   \
+            default: break;                                                                         \
+        }                                                                                           \
+        double sum = 0;                                                                             \
+        for (int i = 0; i < count; ++i)                                                             \
+            sum += sq ? ((double)values[i] - mu) * ((double)values[i] - mu) : (double)values[i];    \
+        return sum;                                                                                 \
+    }                                                                                               \
+    double ImMean(const T* values, int count) {                                                     \
+        if (count < SIMD_MIN_COUNT)                                                                 \
+            return ImMean<T>(values, count);                                                        \
+        return ImSumSimd(values, count, false, 0) / count;                                          \
+    }                                                                                               \
+    double ImStdDev(const T* values, int count) {                                                   \
+        if (count < SIMD_MIN_COUNT)                                                                 \
+            return ImStdDev<T>(values, count);                                                      \
+        const double mu = ImMean(values, count);                                                    \
+        return ImSqrt(ImSumSimd(values, count, true, mu) / (count - 1.0));                            \
+    }
+
+// Colormap kernels exist only for the types below, so other types (and builds without SIMD) map nothing here
+template <typename T>
+static int ImColormapSimd(const T*, int, double, double, const ImU32*, float, float, float, ImU32*) { return 0; }
+
+#if defined IMPLOT_SIMD_SSE2 || defined IMPLOT_SIMD_NEON
+    #define IMPLOT_SIMD_DEFINE_COLORMAP(T)                                                                                                             \
+        static int ImColormapSimd(const T* values, int count, double x0, double x1, const ImU32* table, float mul, float add, float lim, ImU32* out) { \
+            switch (GetSimdLevel()) {                                                                                                                  \
+                IMPLOT_SIMD_CASE_AVX2(ColormapAVX2(values, count, x0, x1, table, mul, add, lim, out))                                                  \
+                IMPLOT_SIMD_CASE_SSE2(ColormapSSE2(values, count, x0, x1, table, mul, add, lim, out))                                                  \
+                IMPLOT_SIMD_CASE_NEON(ColormapNEON(values, count, x0, x1, table, mul, add, lim, out))                                                  \
+                default: break;                                                                                                                        \
+            }                                                                                                                                          \
+            return 0;                                                                                                                                  \
+        }
+#else
+    #define IMPLOT_SIMD_DEFINE_COLORMAP(T)
+#endif
+
+#ifdef IMPLOT_SIMD_AVX2
+    #define IMPLOT_SIMD_CASE_AVX2(call) case ImPlotSimdLevel_AVX2: return call;
+#else
+    #define IMPLOT_SIMD_CASE_AVX2(call)
+#endif
+#ifdef IMPLOT_SIMD_SSE2
+    #define IMPLOT_SIMD_CASE_SSE2(call) case ImPlotSimdLevel_SSE2: return call;
+#else
+    #define IMPLOT_SIMD_CASE_SSE2(call)
+#endif
+#ifdef IMPLOT_SIMD_NEON
+    #define IMPLOT_SIMD_CASE_NEON(call) case ImPlotSimdLevel_NEON: return call;
+#else
+    #define IMPLOT_SIMD_CASE_NEON(call)
+#endif
+
+IMPLOT_SIMD_DEFINE_MINMAX(float,  F32)
+IMPLOT_SIMD_DEFINE_MINMAX(double, F64)
+IMPLOT_SIMD_DEFINE_MINMAX(ImS32,  S32)
+IMPLOT_SIMD_DEFINE_MINMAX(ImU8,   U8)
+IMPLOT_SIMD_DEFINE_MINMAX(ImU16,  U16)
+IMPLOT_SIMD_DEFINE_STATS(float)
+IMPLOT_SIMD_DEFINE_STATS(double)
+IMPLOT_SIMD_DEFINE_STATS(ImS32)
+IMPLOT_SIMD_DEFINE_STATS(ImU8)
+IMPLOT_SIMD_DEFINE_STATS(ImU16)
+IMPLOT_SIMD_DEFINE_COLORMAP(float)
+IMPLOT_SIMD_DEFINE_COLORMAP(double)
+IMPLOT_SIMD_DEFINE_COLORMAP(ImS32)
+IMPLOT_SIMD_DEFINE_COLORMAP(ImU8)
+IMPLOT_SIMD_DEFINE_COLORMAP(ImU16)
+
+#undef IMPLOT_SIMD_DEFINE_MINMAX
+#undef IMPLOT_SIMD_DEFINE_STATS
+#undef IMPLOT_SIMD_DEFINE_COLORMAP
+#undef IMPLOT_SIMD_CASE_AVX2
+#undef IMPLOT_SIMD_CASE_SSE2
+#undef IMPLOT_SIMD_CASE_NEON
+
 namespace ImPlot {
 
 //-----------------------------------------------------------------------------
@@ -284,19 +834,27 @@ IMPLOT_INLINE void PrimRectLine(ImDrawList& draw_list, const ImVec2& Pmin, const
 ImPlotItem* RegisterOrGetItem(const char* label_id, ImPlotItemFlags flags, bool* just_created) {
     ImPlotContext& gp = *GImPlot;
     ImPlotItemGroup& Items = *gp.CurrentItems;
-    ImGuiID id = Items.GetItemID(label_id);
+    // items with a valid handle (see SetNextItemHandle) are found without hashing their label
+    const ImPlotItemHandle& handle = gp.NextItemData.Handle;
+    ImPlotItem* item = nullptr;
+    if (handle.Index >= 0 && handle.Index < Items.ItemPool.GetBufSize() && Items.GetItemByIndex(handle.Index)->ID == handle.ID) {
+        item = Items.GetItemByIndex(handle.Index);
+    }
+    else {
+        ImGuiID id = Items.GetItemID(label_id);
+        item = Items.GetOrAddItem(id);
+        item->ID = id;
+    }
     if (just_created != nullptr)
-        *just_created = Items.GetItem(id) == nullptr;
-    ImPlotItem* item = Items.GetOrAddItem(id);
+        *just_created = !item->Plotted;
     if (item->SeenThisFrame)
         return item;
     item->SeenThisFrame = true;
+    item->Plotted = true;
     int idx = Items.GetItemIndex(item);
-    item->ID = id;
     if (!ImHasFlag(flags, ImPlotItemFlags_NoLegend) && ImGui::FindRenderedTextEnd(label_id, nullptr) != label_id) {
         Items.Legend.Indices.push_back(idx);
-        item->NameOffset = Items.Legend.Labels.size();
-        Items.Legend.Labels.append(label_id, label_id + strlen(label_id) + 1);
+        Items.SetItemLabel(item, label_id);
     }
     else {
         item->Show = true;
@@ -384,6 +942,180 @@ void BustColorCache(const char* plot_title_id) {
     }
 }
 
+//-----------------------------------------------------------------------------
+// [SECTION] Vertex Cache
+//-----------------------------------------------------------------------------
+
+static const int VERTEX_CACHE_MAX_IDLE_FRAMES = 60;
+
+// Data pointers are kept so that InvalidateDataCache can find the caches which depend on them
+template <typename T>
+IMPLOT_INLINE ImGuiID HashCacheArg(const T* arg, ImGuiID seed) {
+    ImPlotNextItemData& s = GImPlot->NextItemData;
+    if (s.CacheDataCount < IM_ARRAYSIZE(s.CacheData))
+        s.CacheData[s.CacheDataCount++] = arg;
+    return ImHashData(&arg, sizeof(arg), seed);
+}
+
+IMPLOT_INLINE ImGuiID HashCacheArg(ImPlotGetter arg, ImGuiID seed) {
+    return ImHashData(&arg, sizeof(arg), seed);
+}
+
+IMPLOT_INLINE ImGuiID HashCacheArg(ImPlotBatchGetter arg, ImGuiID seed) {
+    return ImHashData(&arg, sizeof(arg), seed);
+}
+
+IMPLOT_INLINE ImGuiID HashCacheArg(const char* arg, ImGuiID seed) {
+    return arg != nullptr ? ImHashStr(arg, 0, seed) : ImHashData(&arg, sizeof(arg), seed);
+}
+
+template <typename T>
+IMPLOT_INLINE ImGuiID HashCacheArg(const T& arg, ImGuiID seed) {
+    return ImHashData(&arg, sizeof(T), seed);
+}
+
+IMPLOT_INLINE ImGuiID HashCacheArgs(ImGuiID seed) {
+    return seed;
+}
+
+template <typename T, typename... Args>
+IMPLOT_INLINE ImGuiID HashCacheArgs(ImGuiID seed, const T& arg, const Args&... args) {
+    return HashCacheArgs(HashCacheArg(arg, seed), args...);
+}
+
+// Sets the key identifying the vertices the next item will render from its plotter's arguments, and the data pointers
+// its vertex cache and spatial index depend on. Data is hashed by address, not by content, so modified buffers must be
+// reported with InvalidateDataCache.
+template <typename... Args>
+void SetItemCacheKey(ImPlotItemFlags flags, const char* plotter, const Args&... args) {
+    if (!ImHasFlag(flags, ImPlotItemFlags_CacheVertices) && !ImHasFlag(flags, ImPlotItemFlags_SpatialIndex))
+        return;
+    ImPlotNextItemData& s = GImPlot->NextItemData;
+    s.CacheDataCount = 0;
+    const ImGuiID key = HashCacheArgs(ImHashStr(plotter), args...);
+    s.CacheKey = key != 0 ? key : 1;
+}
+
+bool BeginItemVertexCache() {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotNextItemData& s = gp.NextItemData;
+    const int frame = ImGui::GetFrameCount();
+    // discard entries of items which are no longer plotted, once per frame
+    if (gp.VertexCacheFrame != frame) {
+        gp.VertexCacheFrame = frame;
+        for (int i = 0; i < gp.VertexCache.GetMapSize(); ++i) {
+            ImPlotVertexCache* cache = gp.VertexCache.TryGetMapData(i);
+            if (cache != nullptr && frame - cache->LastFrame > VERTEX_CACHE_MAX_IDLE_FRAMES)
+                gp.VertexCache.Remove(gp.VertexCache.Map.Data[i].key, cache);
+        }
+    }
+    if (s.CacheKey == 0)
+        return false;
+    ImPlotPlot& plot = *gp.CurrentPlot;
+    ImDrawList& draw_list = *GetPlotDrawList();
+    // combine the plotter's key with everything else that determines the item's vertices
+    ImGuiID key = s.CacheKey;
+    key = ImHashData(&s.Colors, (size_t)((const char*)&s.HasHidden - (const char*)&s.Colors), key);
+    key = ImHashData(&gp.Style, sizeof(ImPlotStyle), key);
+    key = ImHashData(&gp.ColormapData.Generation, sizeof(int), key);
+    // colors are converted with ImGui::GetColorU32, which applies the style alpha (e.g. within BeginDisabled)
+    key = ImHashData(&ImGui::GetStyle().Alpha, sizeof(float), key);
+    const ImPlotAxis* axes[2] = { &plot.Axes[plot.CurrentX], &plot.Axes[plot.CurrentY] };
+    for (const ImPlotAxis* axis : axes) {
+        const double state[6] = { axis->Range.Min, axis->Range.Max, axis->PixelMin, axis->PixelMax, axis->ScaleMin, axis->ScaleMax };
+        key = ImHashData(state, sizeof(state), key);
+        key = ImHashData(&axis->TransformForward, sizeof(axis->TransformForward), key);
+        key = ImHashData(&axis->TransformData, sizeof(axis->TransformData), key);
+    }
+    key = ImHashData(&plot.PlotRect, sizeof(ImRect), key);
+    key = ImHashData(&draw_list.Flags, sizeof(draw_list.Flags), key);
+    key = ImHashData(&draw_list._CmdHeader.ClipRect, sizeof(ImVec4), key);
+    key = ImHashData(&draw_list._CmdHeader.TextureId, sizeof(ImTextureID), key);
+    // text and marker glyphs depend on the font
+    const ImFont* font    = ImGui::GetFont();
+    const float font_size = ImGui::GetFontSize();
+    key = ImHashData(&font, sizeof(font), key);
+    key = ImHashData(&font_size, sizeof(font_size), key);
+    // items shared between subplots get an entry per plot
+    ImPlotVertexCache& cache = *gp.VertexCache.GetOrAddByKey(ImHashData(&plot.ID, sizeof(ImGuiID), gp.CurrentItem->ID));
+    cache.LastFrame = frame;
+    if (cache.Key == key) {
+        const ImDrawVert* vtx = cache.Vtx.Data;
+        const ImDrawIdx*  idx = cache.Idx.Data;
+        for (int i = 0; i < cache.SegVtxCounts.Size; ++i) {
+            const int vtx_count = cache.SegVtxCounts[i];
+            const int idx_count = cache.SegIdxCounts[i];
+            draw_list.PrimReserve(idx_count, vtx_count);
+            const unsigned int base = draw_list._VtxCurrentIdx;
+            memcpy(draw_list._VtxWritePtr, vtx, vtx_count * sizeof(ImDrawVert));
+            for (int j = 0; j < idx_count; ++j)
+                draw_list._IdxWritePtr[j] = (ImDrawIdx)(base + idx[j]);
+            draw_list._VtxWritePtr   += vtx_count;
+            draw_list._IdxWritePtr   += idx_count;
+            draw_list._VtxCurrentIdx += vtx_count;
+            vtx += vtx_count;
+            idx += idx_count;
+        }
+        GetFrameCacheStats().VerticesHits++;
+        return true;
+    }
+    GetFrameCacheStats().VerticesMisses++;
+    cache.Key = 0;
+    cache.DataCount = s.CacheDataCount;
+    for (int i = 0; i < s.CacheDataCount; ++i)
+        cache.Data[i] = s.CacheData[i];
+    cache.Vtx.resize(0);
+    cache.Idx.resize(0);
+    cache.SegVtxCounts.resize(0);
+    cache.SegIdxCounts.resize(0);
+    gp.CurrentVertexCache    = &cache;
+    gp.CurrentVertexCacheKey = key;
+    gp.VertexCacheVtxStart   = draw_list.VtxBuffer.Size;
+    gp.VertexCacheIdxStart   = draw_list.IdxBuffer.Size;
+    gp.VertexCacheCmdStart   = draw_list.CmdBuffer.Size - 1;
+    return false;
+}
+
+// Stores the vertices rendered since BeginItemVertexCache in the current cache entry
+static void EndItemVertexCache() {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotVertexCache& cache = *gp.CurrentVertexCache;
+    gp.CurrentVertexCache = nullptr;
+    ImDrawList& draw_list = *GetPlotDrawList();
+    for (int c = gp.VertexCacheCmdStart; c < draw_list.CmdBuffer.Size; ++c) {
+        const ImDrawCmd& cmd = draw_list.CmdBuffer[c];
+        const int idx_beg = ImMax((int)cmd.IdxOffset, gp.VertexCacheIdxStart);
+        const int idx_end = (int)(cmd.IdxOffset + cmd.ElemCount);
+        // items that changed the draw state can't be replayed
+        if (cmd.UserCallback != nullptr || cmd.TextureId != draw_list._CmdHeader.TextureId ||
+            memcmp(&cmd.ClipRect, &draw_list._CmdHeader.ClipRect, sizeof(ImVec4)) != 0) {
+            if (idx_end > idx_beg || cmd.UserCallback != nullptr)
+                return;
+        }
+        if (idx_end <= idx_beg)
+            continue;
+        int vtx_min = INT_MAX, vtx_max = -1;
+        for (int i = idx_beg; i < idx_end; ++i) {
+            const int v = (int)(cmd.VtxOffset + draw_list.IdxBuffer.Data[i]);
+            vtx_min = ImMin(vtx_min, v);
+            vtx_max = ImMax(vtx_max, v);
+        }
+        if (vtx_min < gp.VertexCacheVtxStart)
+            return;
+        const int vtx_count = vtx_max - vtx_min + 1;
+        const int vtx_off = cache.Vtx.Size;
+        const int idx_off = cache.Idx.Size;
+        cache.Vtx.resize(vtx_off + vtx_count);
+        cache.Idx.resize(idx_off + idx_end - idx_beg);
+        memcpy(cache.Vtx.Data + vtx_off, draw_list.VtxBuffer.Data + vtx_min, vtx_count * sizeof(ImDrawVert));
+        for (int i = idx_beg; i < idx_end; ++i)
+            cache.Idx.Data[idx_off + i - idx_beg] = (ImDrawIdx)(cmd.VtxOffset + draw_list.IdxBuffer.Data[i] - vtx_min);
+        cache.SegVtxCounts.push_back(vtx_count);
+        cache.SegIdxCounts.push_back(idx_end - idx_beg);
+    }
+    cache.Key = gp.CurrentVertexCacheKey;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] BeginItem / EndItem
 //-----------------------------------------------------------------------------
@@ -396,6 +1128,11 @@ bool BeginItem(const char* label_id, ImPlotItemFlags flags, ImPlotCol recolor_fr
     ImPlotContext& gp = *GImPlot;
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotX() needs to be called between BeginPlot() and EndPlot()!");
     SetupLock();
+    // the subplot cell was replayed from its cache
+    if (gp.CellReplayed) {
+        gp.NextItemData.Reset();
+        return false;
+    }
     bool just_created;
     ImPlotItem* item = RegisterOrGetItem(label_id, flags, &just_created);
     // set current item
@@ -468,6 +1205,15 @@ bool BeginItem(const char* label_id, ImPlotItemFlags flags, ImPlotCol recolor_fr
         s.RenderMarkerLine = s.Colors[ImPlotCol_MarkerOutline].w > 0 && s.MarkerWeight > 0;
         // push rendering clip rect
         PushPlotClipRect();
+        // start recording the item's profile
+        gp.ItemProfile = ImPlotProfile();
+        if (gp.ProfilerEnabled && gp.PlotProfile.Frame >= 0) {
+            ImDrawList& draw_list  = *GetPlotDrawList();
+            gp.ItemProfile.Frame   = gp.PlotProfile.Frame;
+            gp.ItemProfileStart    = GetProfilerTime();
+            gp.ItemProfileVtxStart = draw_list.VtxBuffer.Size;
+            gp.ItemProfileIdxStart = draw_list.IdxBuffer.Size;
+        }
         return true;
     }
 }
@@ -475,8 +1221,38 @@ bool BeginItem(const char* label_id, ImPlotItemFlags flags, ImPlotCol recolor_fr
 // Ends an item (call only if BeginItem returns true)
 void EndItem() {
     ImPlotContext& gp = *GImPlot;
+    // retain vertices of cached items
+    if (gp.CurrentVertexCache != nullptr)
+        EndItemVertexCache();
     // pop rendering clip rect
     PopPlotClipRect();
+    // store the item's profile and add it to the plot's
+    if (gp.ItemProfile.Frame >= 0) {
+        ImPlotProfile& profile = gp.ItemProfile;
+        ImDrawList& draw_list  = *GetPlotDrawList();
+        profile.TotalTime      = GetProfilerTime() - gp.ItemProfileStart;
+        profile.RenderTime     = profile.TotalTime - profile.FitTime;
+        profile.Vertices       = draw_list.VtxBuffer.Size - gp.ItemProfileVtxStart;
+        profile.Indices        = draw_list.IdxBuffer.Size - gp.ItemProfileIdxStart;
+        // items of subplots sharing items are plotted once per plot
+        ImPlotProfile& item = gp.CurrentItem->Profile;
+        if (item.Frame != profile.Frame)
+            item = ImPlotProfile();
+        item.Frame          = profile.Frame;
+        item.FitTime       += profile.FitTime;
+        item.RenderTime    += profile.RenderTime;
+        item.TotalTime     += profile.TotalTime;
+        item.Vertices      += profile.Vertices;
+        item.Indices       += profile.Indices;
+        item.PrimsRendered += profile.PrimsRendered;
+        item.PrimsCulled   += profile.PrimsCulled;
+        ImPlotProfile& plot = gp.PlotProfile;
+        plot.FitTime       += profile.FitTime;
+        plot.RenderTime    += profile.RenderTime;
+        plot.PrimsRendered += profile.PrimsRendered;
+        plot.PrimsCulled   += profile.PrimsCulled;
+        profile.Frame = -1;
+    }
     // reset next item data
     gp.NextItemData.Reset();
     // set current item
@@ -517,6 +1293,30 @@ struct IndexerIdx {
     int Stride;
 };
 
+// Indexes the #size values of a ring buffer of #capacity values, starting at the oldest one at #head. The values are read as the two contiguous
+// spans [head,capacity) and [0,head+size-capacity), which avoids the modulo of IndexerIdx.
+template <typename T>
+struct IndexerRing {
+    IndexerRing(const T* data, int capacity, int head, int size, int stride = sizeof(T)) :
+        Data(data),
+        Count(ImClamp(size, 0, capacity)),
+        Capacity(capacity),
+        Head(capacity ? ImPosMod(head, capacity) : 0),
+        Split(capacity - Head),
+        Stride(stride)
+    { }
+    template <typename I> IMPLOT_INLINE double operator()(I idx) const {
+        const int i = (int)idx + Head - (idx >= Split ? Capacity : 0);
+        return (double)*(const T*)(const void*)((const unsigned char*)Data + (size_t)i * Stride);
+    }
+    const T* Data;
+    int Count;
+    int Capacity;
+    int Head;
+    int Split;  // first index in the second span
+    int Stride;
+};
+
 template <typename _Indexer1, typename _Indexer2>
 struct IndexerAdd {
     IndexerAdd(const _Indexer1& indexer1, const _Indexer2& indexer2, double scale1 = 1, double scale2 = 1)
@@ -551,6 +1351,207 @@ struct IndexerConst {
     const double Ref;
 };
 
+//-----------------------------------------------------------------------------
+// [SECTION] Data Cache
+//-----------------------------------------------------------------------------
+
+// Number of values reduced into each block of the lowest pyramid level
+static const int DATA_CACHE_BLOCK_SIZE = 64;
+// Number of frames a cache entry may go unused before it is discarded
+static const int DATA_CACHE_MAX_IDLE_FRAMES = 60;
+
+template <typename T>
+IMPLOT_INLINE void ExtendDataRange(const T* data, int first, int last, int stride, ImPlotRange& out) {
+    for (int i = first; i < last; ++i) {
+        const double v = (double)IndexData(data, i, 0, 0, stride);
+        if (!ImNanOrInf(v)) {
+            out.Min = v < out.Min ? v : out.Min;
+            out.Max = v > out.Max ? v : out.Max;
+        }
+    }
+}
+
+void InvalidateDataCache(const void* data) {
+    ImPlotContext& gp = *GImPlot;
+    // textures are kept and only marked for re-upload
+    for (int i = 0; i < gp.HeatmapTextures.GetMapSize(); ++i) {
+        ImPlotHeatmapTexture* tex = gp.HeatmapTextures.TryGetMapData(i);
+        if (tex != nullptr && (data == nullptr || tex->Data == data))
+            tex->Key = 0;
+    }
+    if (data == nullptr) {
+        gp.DataCache.Clear();
+        gp.VertexCache.Clear();
+        gp.DigitalRuns.Clear();
+        gp.SpatialIndices.Clear();
+        return;
+    }
+    for (int i = 0; i < gp.DataCache.GetMapSize(); ++i) {
+        ImPlotDataCache* cache = gp.DataCache.TryGetMapData(i);
+        if (cache != nullptr && cache->Data == data)
+            gp.DataCache.Remove(gp.DataCache.Map.Data[i].key, cache);
+    }
+    for (int i = 0; i < gp.VertexCache.GetMapSize(); ++i) {
+        ImPlotVertexCache* cache = gp.VertexCache.TryGetMapData(i);
+        if (cache != nullptr && cache->UsesData(data))
+            gp.VertexCache.Remove(gp.VertexCache.Map.Data[i].key, cache);
+    }
+    for (int i = 0; i < gp.DigitalRuns.GetMapSize(); ++i) {
+        ImPlotDigitalRuns* runs = gp.DigitalRuns.TryGetMapData(i);
+        if (runs != nullptr && runs->Data == data)
+            gp.DigitalRuns.Remove(gp.DigitalRuns.Map.Data[i].key, runs);
+    }
+    for (int i = 0; i < gp.SpatialIndices.GetMapSize(); ++i) {
+        ImPlotSpatialIndex* index = gp.SpatialIndices.TryGetMapData(i);
+        if (index != nullptr && index->UsesData(data))
+            gp.SpatialIndices.Remove(gp.SpatialIndices.Map.Data[i].key, index);
+    }
+}
+
+// Gets (and builds, if needed) the cache entry of a user data buffer.
+template <typename T>
+ImPlotDataCache& GetDataCache(const T* data, int count, int stride) {
+    ImPlotContext& gp = *GImPlot;
+    const int frame = ImGui::GetFrameCount();
+    // discard entries of buffers which are no longer plotted, once per frame
+    if (gp.DataCacheFrame != frame) {
+        gp.DataCacheFrame = frame;
+        for (int i = 0; i < gp.DataCache.GetMapSize(); ++i) {
+            ImPlotDataCache* cache = gp.DataCache.TryGetMapData(i);
+            if (cache != nullptr && frame - cache->LastFrame > DATA_CACHE_MAX_IDLE_FRAMES)
+                gp.DataCache.Remove(gp.DataCache.Map.Data[i].key, cache);
+        }
+    }
+    // the same buffer may be interpreted differently depending on its type, count, and stride
+    const ImU64 key[4] = { (ImU64)(size_t)data, (ImU64)count, (ImU64)stride, (ImU64)sizeof(T) | ((ImU64)((T)0.5 != 0) << 8) | ((ImU64)((T)-1 < 0) << 9) };
+    const ImGuiID id = ImHashData(key, sizeof(key));
+    ImPlotDataCache* cache = gp.DataCache.GetByKey(id);
+    if (cache != nullptr) {
+        GetFrameCacheStats().ExtentsHits++;
+    }
+    else {
+        GetFrameCacheStats().ExtentsMisses++;
+        cache = gp.DataCache.GetOrAddByKey(id);
+        cache->Data = data;
+        // level sizes halve until a single block covers the whole buffer
+        const int blocks = (count + DATA_CACHE_BLOCK_SIZE - 1) / DATA_CACHE_BLOCK_SIZE;
+        cache->Levels.push_back(0);
+        for (int size = blocks; ; size = (size + 1) / 2) {
+            cache->Levels.push_back(cache->Levels.back() + size);
+            if (size <= 1)
+                break;
+        }
+        cache->Mins.resize(cache->Levels.back());
+        cache->Maxs.resize(cache->Levels.back());
+        for (int b = 0; b < blocks; ++b) {
+            ImPlotRange ext(HUGE_VAL, -HUGE_VAL);
+            ExtendDataRange(data, b * DATA_CACHE_BLOCK_SIZE, ImMin(count, (b + 1) * DATA_CACHE_BLOCK_SIZE), stride, ext);
+            cache->Mins[b] = ext.Min;
+            cache->Maxs[b] = ext.Max;
+        }
+        for (int l = 1; l < cache->Levels.Size - 1; ++l) {
+            const int child = cache->Levels[l-1];
+            const int child_end = cache->Levels[l];
+            for (int i = cache->Levels[l], c = child; i < cache->Levels[l+1]; ++i, c += 2) {
+                cache->Mins[i] = c + 1 < child_end ? ImMin(cache->Mins[c], cache->Mins[c+1]) : cache->Mins[c];
+                cache->Maxs[i] = c + 1 < child_end ? ImMax(cache->Maxs[c], cache->Maxs[c+1]) : cache->Maxs[c];
+            }
+        }
+    }
+    cache->LastFrame = frame;
+    return *cache;
+}
+
+// Extends #out with the finite extents of the physical indices [first,last) of a cached buffer.
+template <typename T>
+void QueryDataCache(const ImPlotDataCache& cache, const T* data, int first, int last, int stride, ImPlotRange& out) {
+    const int b0 = (first + DATA_CACHE_BLOCK_SIZE - 1) / DATA_CACHE_BLOCK_SIZE;
+    const int b1 = last / DATA_CACHE_BLOCK_SIZE;
+    if (b0 >= b1) {
+        ExtendDataRange(data, first, last, stride, out);
+        return;
+    }
+    ExtendDataRange(data, first, b0 * DATA_CACHE_BLOCK_SIZE, stride, out);
+    cache.QueryBlocks(b0, b1, out);
+    ExtendDataRange(data, b1 * DATA_CACHE_BLOCK_SIZE, last, stride, out);
+}
+
+// Extends #out with the finite extents of the indices [first,last) of an indexer. Returns false if the
+// indexer doesn't support this, in which case its values must be iterated.
+template <typename _Indexer>
+bool CalcIndexerExtents(const _Indexer&, int, int, ImPlotRange&) {
+    return false;
+}
+
+template <typename T>
+bool CalcIndexerExtents(const IndexerIdx<T>& indexer, int first, int last, ImPlotRange& out) {
+    if (first >= last)
+        return true;
+    const ImPlotDataCache& cache = GetDataCache(indexer.Data, indexer.Count, indexer.Stride);
+    // logical indices are rotated by the offset, so the range may wrap around the end of the buffer
+    first += indexer.Offset;
+    last  += indexer.Offset;
+    QueryDataCache(cache, indexer.Data, ImMin(first, indexer.Count), ImMin(last, indexer.Count), indexer.Stride, out);
+    if (last > indexer.Count)
+        QueryDataCache(cache, indexer.Data, ImMax(first - indexer.Count, 0), last - indexer.Count, indexer.Stride, out);
+    return true;
+}
+
+template <typename T>
+bool CalcIndexerExtents(const IndexerRing<T>& indexer, int first, int last, ImPlotRange& out) {
+    if (first >= last)
+        return true;
+    const ImPlotDataCache& cache = GetDataCache(indexer.Data, indexer.Capacity, indexer.Stride);
+    first += indexer.Head;
+    last  += indexer.Head;
+    QueryDataCache(cache, indexer.Data, ImMin(first, indexer.Capacity), ImMin(last, indexer.Capacity), indexer.Stride, out);
+    if (last > indexer.Capacity)
+        QueryDataCache(cache, indexer.Data, ImMax(first - indexer.Capacity, 0), last - indexer.Capacity, indexer.Stride, out);
+    return true;
+}
+
+inline bool CalcIndexerExtents(const IndexerLin& indexer, int first, int last, ImPlotRange& out) {
+    if (first >= last)
+        return true;
+    const double v1 = indexer(first);
+    const double v2 = indexer(last - 1);
+    if (!ImNanOrInf(v1) && !ImNanOrInf(v2)) {
+        out.Min = ImMin(out.Min, ImMin(v1, v2));
+        out.Max = ImMax(out.Max, ImMax(v1, v2));
+    }
+    return true;
+}
+
+inline bool CalcIndexerExtents(const IndexerConst& indexer, int first, int last, ImPlotRange& out) {
+    if (first < last && !ImNanOrInf(indexer.Ref)) {
+        out.Min = ImMin(out.Min, indexer.Ref);
+        out.Max = ImMax(out.Max, indexer.Ref);
+    }
+    return true;
+}
+
+// Finds the extents of the finite values of an array, from the data cache if #cached is true. If there are none, the
+// result of ImMinMaxArray is returned.
+template <typename T>
+ImPlotRange CalcArrayExtents(const T* values, int count, bool cached) {
+    if (cached && count > 0) {
+        ImPlotRange ext(HUGE_VAL, -HUGE_VAL);
+        CalcIndexerExtents(IndexerIdx<T>(values, count), 0, count, ext);
+        if (ext.Min <= ext.Max)
+            return ext;
+    }
+    T min, max;
+    ImMinMaxArray(values, count, &min, &max);
+    // NaN and infinite values are ignored like by the cache, which takes another pass if there are any
+    if (ImNanOrInf((double)min) || ImNanOrInf((double)max)) {
+        ImPlotRange ext(HUGE_VAL, -HUGE_VAL);
+        ExtendDataRange(values, 0, count, sizeof(T), ext);
+        if (ext.Min <= ext.Max)
+            return ext;
+    }
+    return ImPlotRange((double)min, (double)max);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Getters
 //-----------------------------------------------------------------------------
@@ -566,7 +1567,7 @@ struct GetterXY {
     const int Count;
 };
 
-/// Interprets a user's function pointer as ImPlotPoints
+// Interprets a user's function pointer as ImPlotPoints
 struct GetterFuncPtr {
     GetterFuncPtr(ImPlotGetter getter, void* data, int count) :
         Getter(getter),
@@ -581,6 +1582,22 @@ struct GetterFuncPtr {
     const int Count;
 };
 
+struct GetterBatchPtr {
+    GetterBatchPtr(ImPlotBatchGetter getter, void* data, int count) :
+        Getter(getter),
+        Data(data),
+        Count(count)
+    { }
+    template <typename I> IMPLOT_INLINE ImPlotPoint operator()(I idx) const {
+        ImPlotPoint p;
+        Getter((int)idx, 1, &p, Data);
+        return p;
+    }
+    ImPlotBatchGetter Getter;
+    void* const Data;
+    const int Count;
+};
+
 template <typename _Getter>
 struct GetterOverrideX {
     GetterOverrideX(_Getter getter, double x) : Getter(getter), X(x), Count(getter.Count) { }
@@ -618,18 +1635,86 @@ struct GetterLoop {
     const int Count;
 };
 
-template <typename T>
-struct GetterError {
-    GetterError(const T* xs, const T* ys, const T* neg, const T* pos, int count, int offset, int stride) :
-        Xs(xs),
-        Ys(ys),
-        Neg(neg),
-        Pos(pos),
-        Count(count),
-        Offset(count ? ImPosMod(offset, count) : 0),
-        Stride(stride)
-    { }
-    template <typename I> IMPLOT_INLINE ImPlotPointError operator()(I idx) const {
+// Exposes a contiguous range of another getter's points
+template <typename _Getter>
+struct GetterSlice {
+    GetterSlice(const _Getter& getter, int start, int count) : Getter(getter), Start(start), Count(count) { }
+    template <typename I> IMPLOT_INLINE ImPlotPoint operator()(I idx) const {
+        return Getter(Start + idx);
+    }
+    const _Getter Getter;
+    const int Start;
+    const int Count;
+};
+
+// Returns the points of a getter with ascending X that lie on the current X axis, plus one neighbor on each side,
+// found by binary search. If #sorted is false, all points are returned.
+template <typename _Getter>
+GetterSlice<_Getter> SliceVisibleX(const _Getter& getter, bool sorted) {
+    if (!sorted || getter.Count <= 2)
+        return GetterSlice<_Getter>(getter, 0, getter.Count);
+    const ImPlotPlot& plot = *GImPlot->CurrentPlot;
+    const ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+    const ImPlotNextItemData& s = GImPlot->NextItemData;
+    const float pad = (x_axis.PixelMin <= x_axis.PixelMax ? 1.0f : -1.0f) * (s.MarkerSize + s.MarkerWeight);
+    const double v1 = x_axis.PixelsToPlot(x_axis.PixelMin - pad);
+    const double v2 = x_axis.PixelsToPlot(x_axis.PixelMax + pad);
+    const double x_min = ImMin(v1, v2);
+    const double x_max = ImMax(v1, v2);
+    // first index with x >= x_min
+    int lo = 0, hi = getter.Count;
+    while (lo < hi) {
+        const int mid = lo + (hi - lo) / 2;
+        if (getter(mid).x < x_min)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    const int first = ImMax(lo - 1, 0);
+    // first index with x > x_max
+    hi = getter.Count;
+    while (lo < hi) {
+        const int mid = lo + (hi - lo) / 2;
+        if (getter(mid).x <= x_max)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    const int last = ImMin(lo + 1, getter.Count);
+    return GetterSlice<_Getter>(getter, first, last - first);
+}
+
+// Number of points fetched at once with GetPoints when iterating a getter
+static const int GETTER_BATCH_SIZE = 128;
+
+// Fetches #count consecutive points of a getter starting at #idx, with a single call for batch getters.
+template <typename _Getter>
+IMPLOT_INLINE void GetPoints(const _Getter& getter, int idx, int count, ImPlotPoint* out) {
+    for (int i = 0; i < count; ++i)
+        out[i] = getter(idx + i);
+}
+
+IMPLOT_INLINE void GetPoints(const GetterBatchPtr& getter, int idx, int count, ImPlotPoint* out) {
+    getter.Getter(idx, count, out, getter.Data);
+}
+
+template <typename _Getter>
+IMPLOT_INLINE void GetPoints(const GetterSlice<_Getter>& getter, int idx, int count, ImPlotPoint* out) {
+    GetPoints(getter.Getter, getter.Start + idx, count, out);
+}
+
+template <typename T>
+struct GetterError {
+    GetterError(const T* xs, const T* ys, const T* neg, const T* pos, int count, int offset, int stride) :
+        Xs(xs),
+        Ys(ys),
+        Neg(neg),
+        Pos(pos),
+        Count(count),
+        Offset(count ? ImPosMod(offset, count) : 0),
+        Stride(stride)
+    { }
+    template <typename I> IMPLOT_INLINE ImPlotPointError operator()(I idx) const {
         return ImPlotPointError((double)IndexData(Xs,  idx, Count, Offset, Stride),
                                 (double)IndexData(Ys,  idx, Count, Offset, Stride),
                                 (double)IndexData(Neg, idx, Count, Offset, Stride),
@@ -648,17 +1733,80 @@ struct GetterError {
 // [SECTION] Fitters
 //-----------------------------------------------------------------------------
 
+// Fits a getter from the data cache. Returns false if the getter doesn't support this, in which case it must be iterated.
+template <typename _Getter>
+bool FitCached(const _Getter&, ImPlotAxis&, ImPlotAxis&, bool) {
+    return false;
+}
+
+template <typename _IndexerX, typename _IndexerY>
+bool FitCached(const GetterXY<_IndexerX,_IndexerY>& getter, ImPlotAxis& x_axis, ImPlotAxis& y_axis, bool sorted_x) {
+    // a range fit of x depends on every y value, and a range fit of y can only be reduced to a sub-range if x is sorted
+    if (ImHasFlag(x_axis.Flags, ImPlotAxisFlags_RangeFit))
+        return false;
+    const bool range_fit_y = ImHasFlag(y_axis.Flags, ImPlotAxisFlags_RangeFit);
+    if (range_fit_y && !sorted_x)
+        return false;
+    ImPlotRange ext_x(HUGE_VAL, -HUGE_VAL);
+    ImPlotRange ext_y(HUGE_VAL, -HUGE_VAL);
+    if (!CalcIndexerExtents(getter.IndxerX, 0, getter.Count, ext_x))
+        return false;
+    int first = 0, last = getter.Count;
+    if (range_fit_y) {
+        int lo = 0, hi = getter.Count;
+        while (lo < hi) {
+            const int mid = lo + (hi - lo) / 2;
+            if (getter.IndxerX(mid) < x_axis.Range.Min) lo = mid + 1; else hi = mid;
+        }
+        first = lo;
+        hi = getter.Count;
+        while (lo < hi) {
+            const int mid = lo + (hi - lo) / 2;
+            if (getter.IndxerX(mid) <= x_axis.Range.Max) lo = mid + 1; else hi = mid;
+        }
+        last = lo;
+    }
+    if (!CalcIndexerExtents(getter.IndxerY, first, last, ext_y))
+        return false;
+    // values outside of the axis constraints are skipped one by one when fitting, which extents can't reproduce
+    if ((ext_x.Min <= ext_x.Max && !(x_axis.ConstraintRange.Contains(ext_x.Min) && x_axis.ConstraintRange.Contains(ext_x.Max))) ||
+        (ext_y.Min <= ext_y.Max && !(y_axis.ConstraintRange.Contains(ext_y.Min) && y_axis.ConstraintRange.Contains(ext_y.Max))))
+        return false;
+    if (ext_x.Min <= ext_x.Max) {
+        x_axis.ExtendFit(ext_x.Min);
+        x_axis.ExtendFit(ext_x.Max);
+    }
+    if (ext_y.Min <= ext_y.Max) {
+        y_axis.ExtendFit(ext_y.Min);
+        y_axis.ExtendFit(ext_y.Max);
+    }
+    return true;
+}
+
+// Extends the fit of both axes with the points of a getter, fetched in blocks.
+template <typename _Getter>
+void FitPoints(const _Getter& getter, ImPlotAxis& x_axis, ImPlotAxis& y_axis) {
+    ImPlotPoint pts[GETTER_BATCH_SIZE];
+    for (int i = 0; i < getter.Count; i += GETTER_BATCH_SIZE) {
+        const int n = ImMin(GETTER_BATCH_SIZE, getter.Count - i);
+        GetPoints(getter, i, n, pts);
+        for (int j = 0; j < n; ++j) {
+            x_axis.ExtendFitWith(y_axis, pts[j].x, pts[j].y);
+            y_axis.ExtendFitWith(x_axis, pts[j].y, pts[j].x);
+        }
+    }
+}
+
 template <typename _Getter1>
 struct Fitter1 {
-    Fitter1(const _Getter1& getter) : Getter(getter) { }
+    Fitter1(const _Getter1& getter, ImPlotItemFlags flags = 0) : Getter(getter), Flags(flags) { }
     void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
-        for (int i = 0; i < Getter.Count; ++i) {
-            ImPlotPoint p = Getter(i);
-            x_axis.ExtendFitWith(y_axis, p.x, p.y);
-            y_axis.ExtendFitWith(x_axis, p.y, p.x);
-        }
+        if (ImHasFlag(Flags, ImPlotItemFlags_CacheExtents) && FitCached(Getter, x_axis, y_axis, ImHasFlag(Flags, ImPlotItemFlags_SortedX)))
+            return;
+        FitPoints(Getter, x_axis, y_axis);
     }
     const _Getter1& Getter;
+    const ImPlotItemFlags Flags;
 };
 
 template <typename _Getter1>
@@ -687,21 +1835,18 @@ struct FitterY {
 
 template <typename _Getter1, typename _Getter2>
 struct Fitter2 {
-    Fitter2(const _Getter1& getter1, const _Getter2& getter2) : Getter1(getter1), Getter2(getter2) { }
+    Fitter2(const _Getter1& getter1, const _Getter2& getter2, ImPlotItemFlags flags = 0) : Getter1(getter1), Getter2(getter2), Flags(flags) { }
     void Fit(ImPlotAxis& x_axis, ImPlotAxis& y_axis) const {
-        for (int i = 0; i < Getter1.Count; ++i) {
-            ImPlotPoint p = Getter1(i);
-            x_axis.ExtendFitWith(y_axis, p.x, p.y);
-            y_axis.ExtendFitWith(x_axis, p.y, p.x);
-        }
-        for (int i = 0; i < Getter2.Count; ++i) {
-            ImPlotPoint p = Getter2(i);
-            x_axis.ExtendFitWith(y_axis, p.x, p.y);
-            y_axis.ExtendFitWith(x_axis, p.y, p.x);
-        }
+        const bool cached = ImHasFlag(Flags, ImPlotItemFlags_CacheExtents);
+        const bool sorted = ImHasFlag(Flags, ImPlotItemFlags_SortedX);
+        if (!cached || !FitCached(Getter1, x_axis, y_axis, sorted))
+            FitPoints(Getter1, x_axis, y_axis);
+        if (!cached || !FitCached(Getter2, x_axis, y_axis, sorted))
+            FitPoints(Getter2, x_axis, y_axis);
     }
     const _Getter1& Getter1;
     const _Getter2& Getter2;
+    const ImPlotItemFlags Flags;
 };
 
 template <typename _Getter1, typename _Getter2>
@@ -768,6 +1913,238 @@ struct FitterRect {
     const ImPlotPoint Pmax;
 };
 
+//-----------------------------------------------------------------------------
+// [SECTION] Spatial Index
+//-----------------------------------------------------------------------------
+
+// Trees of up to this many points are searched linearly
+static const int SPATIAL_INDEX_LEAF_SIZE = 8;
+// Number of frames an index may go unused before it is discarded
+static const int SPATIAL_INDEX_MAX_IDLE_FRAMES = 60;
+
+static inline double SpatialCoord(const ImPlotSpatialPoint& p, int dim) {
+    return dim == 0 ? p.X : p.Y;
+}
+
+static inline double ToScaleSpace(const ImPlotAxis& axis, double v) {
+    return axis.TransformForward != nullptr ? axis.TransformForward(v, axis.TransformData) : v;
+}
+
+// Gets the spatial index of the current item, emptied if the item's data pointers or axes have changed.
+static ImPlotSpatialIndex& GetItemSpatialIndex() {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotPlot& plot = *gp.CurrentPlot;
+    const int frame = ImGui::GetFrameCount();
+    // discard indices of items which are no longer plotted, once per frame
+    if (gp.SpatialIndicesFrame != frame) {
+        gp.SpatialIndicesFrame = frame;
+        for (int i = 0; i < gp.SpatialIndices.GetMapSize(); ++i) {
+            ImPlotSpatialIndex* index = gp.SpatialIndices.TryGetMapData(i);
+            if (index != nullptr && frame - index->LastFrame > SPATIAL_INDEX_MAX_IDLE_FRAMES)
+                gp.SpatialIndices.Remove(gp.SpatialIndices.Map.Data[i].key, index);
+        }
+    }
+    ImPlotSpatialIndex& index = *gp.SpatialIndices.GetOrAddByKey(ImHashData(&plot.ID, sizeof(ImGuiID), gp.CurrentItem->ID));
+    index.LastFrame = frame;
+    const ImPlotNextItemData& s = gp.NextItemData;
+    const ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+    const ImPlotAxis& y_axis = plot.Axes[plot.CurrentY];
+    bool same = index.XAxis == plot.CurrentX && index.YAxis == plot.CurrentY && index.DataCount == s.CacheDataCount
+             && index.TransformX == x_axis.TransformForward && index.TransformDataX == x_axis.TransformData
+             && index.TransformY == y_axis.TransformForward && index.TransformDataY == y_axis.TransformData;
+    for (int i = 0; same && i < s.CacheDataCount; ++i)
+        same = index.Data[i] == s.CacheData[i];
+    if (!same) {
+        index.Reset();
+        index.XAxis = plot.CurrentX;
+        index.YAxis = plot.CurrentY;
+        index.TransformX = x_axis.TransformForward;
+        index.TransformY = y_axis.TransformForward;
+        index.TransformDataX = x_axis.TransformData;
+        index.TransformDataY = y_axis.TransformData;
+        index.DataCount = s.CacheDataCount;
+        for (int i = 0; i < s.CacheDataCount; ++i)
+            index.Data[i] = s.CacheData[i];
+    }
+    return index;
+}
+
+// Whether logical index 0 of a getter moves through its storage with its #offset or #head, e.g. as data is streamed in
+template <typename _Indexer> static inline bool IsRotated(const _Indexer&)         { return false; }
+template <typename T>        static inline bool IsRotated(const IndexerIdx<T>& i)  { return i.Offset != 0; }
+template <typename T>        static inline bool IsRotated(const IndexerRing<T>&)   { return true; }
+template <typename _IndexerX, typename _IndexerY>
+static inline bool IsRotated(const GetterXY<_IndexerX,_IndexerY>& g) { return IsRotated(g.IndxerX) || IsRotated(g.IndxerY); }
+
+template <typename _Getter>
+void UpdateSpatialIndex(const Fitter1<_Getter>& fitter) {
+    const _Getter& getter = fitter.Getter;
+    // rotated data would have to be reindexed whenever it rotates, so it isn't indexed at all
+    if (IsRotated(getter)) {
+        ImPlotContext& gp = *GImPlot;
+        const ImGuiID key = ImHashData(&gp.CurrentPlot->ID, sizeof(ImGuiID), gp.CurrentItem->ID);
+        ImPlotSpatialIndex* old = gp.SpatialIndices.GetByKey(key);
+        if (old != nullptr)
+            gp.SpatialIndices.Remove(key, old);
+        return;
+    }
+    ImPlotSpatialIndex& index = GetItemSpatialIndex();
+    // start over unless the data indexed so far is unchanged (assuming data was only appended if its ends are)
+    if (index.Count > 0) {
+        bool appended = getter.Count >= index.Count;
+        if (appended) {
+            const ImPlotPoint first = getter(0);
+            const ImPlotPoint last  = getter(index.Count - 1);
+            appended = memcmp(&first, &index.First, sizeof(ImPlotPoint)) == 0 && memcmp(&last, &index.Last, sizeof(ImPlotPoint)) == 0;
+        }
+        if (!appended) {
+            index.Reset();
+        }
+    }
+    if (getter.Count == index.Count)
+        return;
+    ImPlotPlot& plot = *GImPlot->CurrentPlot;
+    const ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+    const ImPlotAxis& y_axis = plot.Axes[plot.CurrentY];
+    index.Points.reserve(index.Points.Size + getter.Count - index.Count);
+    for (int i = index.Count; i < getter.Count; ++i) {
+        const ImPlotPoint p = getter(i);
+        ImPlotSpatialPoint sp;
+        sp.X = ToScaleSpace(x_axis, p.x);
+        sp.Y = ToScaleSpace(y_axis, p.y);
+        sp.Index = i;
+        if (!ImNanOrInf(sp.X) && !ImNanOrInf(sp.Y))
+            index.Points.push_back(sp);
+    }
+    index.First = getter(0);
+    index.Last  = getter(getter.Count - 1);
+    index.Count = getter.Count;
+}
+
+// Partially sorts the points [lo,hi) along dimension #dim so that the k-th point is the one it would be if fully sorted
+static void SelectSpatialPoints(ImPlotSpatialPoint* pts, int lo, int hi, int k, int dim) {
+    --hi;
+    while (lo < hi) {
+        const double pivot = SpatialCoord(pts[lo + (hi - lo) / 2], dim);
+        int i = lo, j = hi;
+        while (i <= j) {
+            while (SpatialCoord(pts[i], dim) < pivot) ++i;
+            while (SpatialCoord(pts[j], dim) > pivot) --j;
+            if (i <= j) {
+                ImSwap(pts[i], pts[j]);
+                ++i; --j;
+            }
+        }
+        if (k <= j)
+            hi = j;
+        else if (k >= i)
+            lo = i;
+        else
+            return;
+    }
+}
+
+// Merges the pending points of an index into its trees
+static void MergeSpatialIndex(ImPlotSpatialIndex& index) {
+    if (index.Built == index.Points.Size)
+        return;
+    int start = index.Built;
+    while (!index.Trees.empty() && start - index.Trees.back() <= index.Points.Size - start) {
+        start = index.Trees.back();
+        index.Trees.pop_back();
+    }
+    index.Trees.push_back(start);
+    index.Split.resize(index.Points.Size);
+    memset(index.Split.Data + start, 0, (index.Points.Size - start) * sizeof(bool));
+    index.Built = index.Points.Size;
+}
+
+// Nearest point search in pixel space, where a scale space offset (dx,dy) measures (dx*Kx,dy*Ky) pixels
+struct SpatialQuery {
+    double X, Y, Kx, Ky;
+    double BestDist2;
+    int    Best;
+    ImPlotSpatialPoint BestPoint;
+
+    IMPLOT_INLINE void Test(const ImPlotSpatialPoint& p) {
+        const double dx = (p.X - X) * Kx;
+        const double dy = (p.Y - Y) * Ky;
+        const double d2 = dx * dx + dy * dy;
+        // ties go to the first point plotted
+        if (d2 < BestDist2 || (d2 == BestDist2 && (Best == -1 || p.Index < Best))) {
+            BestDist2 = d2;
+            Best      = p.Index;
+            BestPoint = p;
+        }
+    }
+};
+
+// Searches the implicit k-d tree of the points [lo,hi), in which the middle point splits the others along dimension
+// #depth % 2. Trees are built lazily: the points of a subtree are only partitioned when a search first reaches it.
+static void QuerySpatialTree(ImPlotSpatialPoint* pts, bool* split, int lo, int hi, int depth, SpatialQuery& q) {
+    while (hi - lo > SPATIAL_INDEX_LEAF_SIZE) {
+        const int mid = lo + (hi - lo) / 2;
+        if (!split[mid]) {
+            SelectSpatialPoints(pts, lo, hi, mid, depth & 1);
+            split[mid] = true;
+        }
+        const ImPlotSpatialPoint& p = pts[mid];
+        q.Test(p);
+        const double d = (depth & 1) ? (q.Y - p.Y) * q.Ky : (q.X - p.X) * q.Kx;
+        const bool below = (depth & 1) ? q.Y < p.Y : q.X < p.X;
+        // search the half containing the query point first, then the other if it may hold a nearer point
+        if (below)
+            QuerySpatialTree(pts, split, lo, mid, depth + 1, q);
+        else
+            QuerySpatialTree(pts, split, mid + 1, hi, depth + 1, q);
+        if (d * d > q.BestDist2)
+            return;
+        if (below)
+            lo = mid + 1;
+        else
+            hi = mid;
+        ++depth;
+    }
+    for (int i = lo; i < hi; ++i)
+        q.Test(pts[i]);
+}
+
+// Pixels per unit of an axis' scale space
+static inline double ScaleSpaceToPixel(const ImPlotAxis& axis) {
+    return axis.TransformForward != nullptr ? axis.ScaleToPixel * axis.Range.Size() / (axis.ScaleMax - axis.ScaleMin) : axis.ScaleToPixel;
+}
+
+int QueryNearestPoint(const char* label_id, float radius_px, ImPlotPoint* point) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "QueryNearestPoint() needs to be called between BeginPlot() and EndPlot()!");
+    SetupLock();
+    ImPlotPlot& plot = *gp.CurrentPlot;
+    ImPlotItem* item = GetItem(label_id);
+    if (item == nullptr || !item->Show)
+        return -1;
+    ImPlotSpatialIndex* index = gp.SpatialIndices.GetByKey(ImHashData(&plot.ID, sizeof(ImGuiID), item->ID));
+    if (index == nullptr)
+        return -1;
+    MergeSpatialIndex(*index);
+    const ImPlotAxis& x_axis = plot.Axes[index->XAxis];
+    const ImPlotAxis& y_axis = plot.Axes[index->YAxis];
+    const ImVec2 mouse = ImGui::GetMousePos();
+    SpatialQuery q;
+    q.X  = ToScaleSpace(x_axis, x_axis.PixelsToPlot(mouse.x));
+    q.Y  = ToScaleSpace(y_axis, y_axis.PixelsToPlot(mouse.y));
+    q.Kx = ScaleSpaceToPixel(x_axis);
+    q.Ky = ScaleSpaceToPixel(y_axis);
+    q.BestDist2 = (double)radius_px * radius_px;
+    q.Best = -1;
+    for (int t = 0; t < index->Trees.Size; ++t)
+        QuerySpatialTree(index->Points.Data, index->Split.Data, index->Trees[t], t + 1 < index->Trees.Size ? index->Trees[t+1] : index->Built, 0, q);
+    if (q.Best != -1 && point != nullptr) {
+        point->x = x_axis.TransformInverse != nullptr ? x_axis.TransformInverse(q.BestPoint.X, x_axis.TransformData) : q.BestPoint.X;
+        point->y = y_axis.TransformInverse != nullptr ? y_axis.TransformInverse(q.BestPoint.Y, y_axis.TransformData) : q.BestPoint.Y;
+    }
+    return q.Best;
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Transformers
 //-----------------------------------------------------------------------------
@@ -840,10 +2217,70 @@ struct Transformer2 {
         return out;
     }
 
+    // Transforms a block of points. Linear axes are transformed two components at a time with SIMD, while
+    // non-linear axes fall back to the scalar path (still in a tight loop, which amortizes the call overhead).
+    void operator()(const ImPlotPoint* plt, ImVec2* out, int count) const {
+        if (Tx.TransformFwd != nullptr || Ty.TransformFwd != nullptr) {
+            for (int i = 0; i < count; ++i)
+                out[i] = (*this)(plt[i]);
+            return;
+        }
+        int i = 0;
+#if defined IMPLOT_SIMD_SSE2
+        const __m128d plt_min = _mm_setr_pd(Tx.PltMin, Ty.PltMin);
+        const __m128d pix_min = _mm_setr_pd(Tx.PixMin, Ty.PixMin);
+        const __m128d m       = _mm_setr_pd(Tx.M, Ty.M);
+        for (; i < count; ++i) {
+            const __m128d p = _mm_add_pd(pix_min, _mm_mul_pd(m, _mm_sub_pd(_mm_loadu_pd(&plt[i].x), plt_min)));
+            _mm_storel_pi((__m64*)&out[i], _mm_cvtpd_ps(p));
+        }
+#elif defined IMPLOT_SIMD_NEON
+        const float64x2_t plt_min = { Tx.PltMin, Ty.PltMin };
+        const float64x2_t pix_min = { Tx.PixMin, Ty.PixMin };
+        const float64x2_t m       = { Tx.M, Ty.M };
+        for (; i < count; ++i) {
+            const float64x2_t p = vaddq_f64(pix_min, vmulq_f64(m, vsubq_f64(vld1q_f64(&plt[i].x), plt_min)));
+            vst1_f32(&out[i].x, vcvt_f32_f64(p));
+        }
+#endif
+        for (; i < count; ++i)
+            out[i] = (*this)(plt[i]);
+    }
+
     Transformer1 Tx;
     Transformer1 Ty;
 };
 
+// Number of points fetched and transformed at once by TransformerBatch and RendererRectC
+static const int TRANSFORM_BATCH_SIZE = 128;
+
+// Fetches points from a getter and transforms them to pixels in blocks. Points must be accessed in (roughly) ascending order.
+template <typename _Getter>
+struct TransformerBatch {
+    TransformerBatch(const _Getter& getter, const Transformer2& transformer) :
+        Getter(getter),
+        Transformer(transformer),
+        Start(0),
+        End(0)
+    { }
+    IMPLOT_INLINE ImVec2 operator()(int idx) const {
+        if (idx < Start || idx >= End)
+            Fetch(idx);
+        return Pixels[idx - Start];
+    }
+    void Fetch(int idx) const {
+        ImPlotPoint plt[TRANSFORM_BATCH_SIZE];
+        Start = idx;
+        End   = ImMin(idx + TRANSFORM_BATCH_SIZE, Getter.Count);
+        GetPoints(Getter, Start, End - Start, plt);
+        Transformer(plt, Pixels, End - Start);
+    }
+    const _Getter& Getter;
+    const Transformer2& Transformer;
+    mutable int Start, End;
+    mutable ImVec2 Pixels[TRANSFORM_BATCH_SIZE];
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Renderers
 //-----------------------------------------------------------------------------
@@ -854,6 +2291,8 @@ struct RendererBase {
         IdxConsumed(idx_consumed),
         VtxConsumed(vtx_consumed)
     { }
+    // Restores any state carried between primitives as if rendering had started at #prim (see RenderPrimitivesParallel)
+    void Seek(int) const { }
     const int Prims;
     Transformer2 Transformer;
     const int IdxConsumed;
@@ -864,17 +2303,20 @@ template <class _Getter>
 struct RendererLineStrip : RendererBase {
     RendererLineStrip(const _Getter& getter, ImU32 col, float weight) :
         RendererBase(getter.Count - 1, 6, 4),
-        Getter(getter),
+        Points(getter, this->Transformer),
         Col(col),
         HalfWeight(ImMax(1.0f,weight)*0.5f)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(0);
     }
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
+    void Seek(int prim) const {
+        P1 = Points(prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(prim + 1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
             return false;
@@ -883,7 +2325,7 @@ struct RendererLineStrip : RendererBase {
         P1 = P2;
         return true;
     }
-    const _Getter& Getter;
+    const TransformerBatch<_Getter> Points;
     const ImU32 Col;
     mutable float HalfWeight;
     mutable ImVec2 P1;
@@ -895,17 +2337,23 @@ template <class _Getter>
 struct RendererLineStripSkip : RendererBase {
     RendererLineStripSkip(const _Getter& getter, ImU32 col, float weight) :
         RendererBase(getter.Count - 1, 6, 4),
-        Getter(getter),
+        Points(getter, this->Transformer),
         Col(col),
         HalfWeight(ImMax(1.0f,weight)*0.5f)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(0);
     }
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
+    void Seek(int prim) const {
+        // the last non-NaN point before #prim (or the first point)
+        P1 = Points(prim);
+        for (int i = prim; i > 0 && (ImNan(P1.x) || ImNan(P1.y)); )
+            P1 = this->Transformer(Points.Getter(--i));
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(prim + 1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             if (!ImNan(P2.x) && !ImNan(P2.y))
                 P1 = P2;
@@ -916,7 +2364,7 @@ struct RendererLineStripSkip : RendererBase {
             P1 = P2;
         return true;
     }
-    const _Getter& Getter;
+    const TransformerBatch<_Getter> Points;
     const ImU32 Col;
     mutable float HalfWeight;
     mutable ImVec2 P1;
@@ -1139,17 +2587,20 @@ template <class _Getter>
 struct RendererStairsPre : RendererBase {
     RendererStairsPre(const _Getter& getter, ImU32 col, float weight) :
         RendererBase(getter.Count - 1, 12, 8),
-        Getter(getter),
+        Points(getter, this->Transformer),
         Col(col),
         HalfWeight(ImMax(1.0f,weight)*0.5f)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(0);
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
+    void Seek(int prim) const {
+        P1 = Points(prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(prim + 1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
             return false;
@@ -1159,7 +2610,7 @@ struct RendererStairsPre : RendererBase {
         P1 = P2;
         return true;
     }
-    const _Getter& Getter;
+    const TransformerBatch<_Getter> Points;
     const ImU32 Col;
     mutable float HalfWeight;
     mutable ImVec2 P1;
@@ -1170,17 +2621,20 @@ template <class _Getter>
 struct RendererStairsPost : RendererBase {
     RendererStairsPost(const _Getter& getter, ImU32 col, float weight) :
         RendererBase(getter.Count - 1, 12, 8),
-        Getter(getter),
+        Points(getter, this->Transformer),
         Col(col),
         HalfWeight(ImMax(1.0f,weight) * 0.5f)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(0);
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
+    void Seek(int prim) const {
+        P1 = Points(prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(prim + 1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
             return false;
@@ -1190,7 +2644,7 @@ struct RendererStairsPost : RendererBase {
         P1 = P2;
         return true;
     }
-    const _Getter& Getter;
+    const TransformerBatch<_Getter> Points;
     const ImU32 Col;
     mutable float HalfWeight;
     mutable ImVec2 P1;
@@ -1201,17 +2655,20 @@ template <class _Getter>
 struct RendererStairsPreShaded : RendererBase {
     RendererStairsPreShaded(const _Getter& getter, ImU32 col) :
         RendererBase(getter.Count - 1, 6, 4),
-        Getter(getter),
+        Points(getter, this->Transformer),
         Col(col)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(0);
         Y0 = this->Transformer(ImPlotPoint(0,0)).y;
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
+    void Seek(int prim) const {
+        P1 = Points(prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(prim + 1);
         ImVec2 PMin(ImMin(P1.x, P2.x), ImMin(Y0, P2.y));
         ImVec2 PMax(ImMax(P1.x, P2.x), ImMax(Y0, P2.y));
         if (!cull_rect.Overlaps(ImRect(PMin, PMax))) {
@@ -1222,7 +2679,7 @@ struct RendererStairsPreShaded : RendererBase {
         P1 = P2;
         return true;
     }
-    const _Getter& Getter;
+    const TransformerBatch<_Getter> Points;
     const ImU32 Col;
     float Y0;
     mutable ImVec2 P1;
@@ -1233,17 +2690,20 @@ template <class _Getter>
 struct RendererStairsPostShaded : RendererBase {
     RendererStairsPostShaded(const _Getter& getter, ImU32 col) :
         RendererBase(getter.Count - 1, 6, 4),
-        Getter(getter),
+        Points(getter, this->Transformer),
         Col(col)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(0);
         Y0 = this->Transformer(ImPlotPoint(0,0)).y;
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
+    void Seek(int prim) const {
+        P1 = Points(prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(prim + 1);
         ImVec2 PMin(ImMin(P1.x, P2.x), ImMin(P1.y, Y0));
         ImVec2 PMax(ImMax(P1.x, P2.x), ImMax(P1.y, Y0));
         if (!cull_rect.Overlaps(ImRect(PMin, PMax))) {
@@ -1254,7 +2714,7 @@ struct RendererStairsPostShaded : RendererBase {
         P1 = P2;
         return true;
     }
-    const _Getter& Getter;
+    const TransformerBatch<_Getter> Points;
     const ImU32 Col;
     float Y0;
     mutable ImVec2 P1;
@@ -1267,19 +2727,23 @@ template <class _Getter1, class _Getter2>
 struct RendererShaded : RendererBase {
     RendererShaded(const _Getter1& getter1, const _Getter2& getter2, ImU32 col) :
         RendererBase(ImMin(getter1.Count, getter2.Count) - 1, 6, 5),
-        Getter1(getter1),
-        Getter2(getter2),
+        Points1(getter1, this->Transformer),
+        Points2(getter2, this->Transformer),
         Col(col)
     {
-        P11 = this->Transformer(Getter1(0));
-        P12 = this->Transformer(Getter2(0));
+        P11 = Points1(0);
+        P12 = Points2(0);
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
+    void Seek(int prim) const {
+        P11 = Points1(prim);
+        P12 = Points2(prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P21 = this->Transformer(Getter1(prim+1));
-        ImVec2 P22 = this->Transformer(Getter2(prim+1));
+        ImVec2 P21 = Points1(prim+1);
+        ImVec2 P22 = Points2(prim+1);
         ImRect rect(ImMin(ImMin(ImMin(P11,P12),P21),P22), ImMax(ImMax(ImMax(P11,P12),P21),P22));
         if (!cull_rect.Overlaps(rect)) {
             P11 = P21;
@@ -1316,8 +2780,8 @@ struct RendererShaded : RendererBase {
         P12 = P22;
         return true;
     }
-    const _Getter1& Getter1;
-    const _Getter2& Getter2;
+    const TransformerBatch<_Getter1> Points1;
+    const TransformerBatch<_Getter2> Points2;
     const ImU32 Col;
     mutable ImVec2 P11;
     mutable ImVec2 P12;
@@ -1332,33 +2796,146 @@ struct RectC {
 
 template <typename _Getter>
 struct RendererRectC : RendererBase {
+    static const int BatchSize = TRANSFORM_BATCH_SIZE / 2;
     RendererRectC(const _Getter& getter) :
         RendererBase(getter.Count, 6, 4),
-        Getter(getter)
+        Getter(getter),
+        Start(0),
+        End(0)
     {}
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        RectC rect = Getter(prim);
-        ImVec2 P1 = this->Transformer(rect.Pos.x - rect.HalfSize.x , rect.Pos.y - rect.HalfSize.y);
-        ImVec2 P2 = this->Transformer(rect.Pos.x + rect.HalfSize.x , rect.Pos.y + rect.HalfSize.y);
-        if ((rect.Color & IM_COL32_A_MASK) == 0 || !cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2))))
+        if (prim < Start || prim >= End)
+            Fetch(prim);
+        const int i = prim - Start;
+        const ImVec2& P1 = Corners[2*i+0];
+        const ImVec2& P2 = Corners[2*i+1];
+        if ((Colors[i] & IM_COL32_A_MASK) == 0 || !cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2))))
             return false;
-        PrimRectFill(draw_list,P1,P2,rect.Color,UV);
+        PrimRectFill(draw_list,P1,P2,Colors[i],UV);
         return true;
     }
+    void Fetch(int prim) const {
+        ImPlotPoint plt[BatchSize*2];
+        Start = prim;
+        End   = ImMin(prim + BatchSize, Getter.Count);
+        for (int i = 0; i < End - Start; ++i) {
+            RectC rect = Getter(Start + i);
+            plt[2*i+0] = ImPlotPoint(rect.Pos.x - rect.HalfSize.x , rect.Pos.y - rect.HalfSize.y);
+            plt[2*i+1] = ImPlotPoint(rect.Pos.x + rect.HalfSize.x , rect.Pos.y + rect.HalfSize.y);
+            Colors[i]  = rect.Color;
+        }
+        this->Transformer(plt, Corners, 2 * (End - Start));
+    }
     const _Getter& Getter;
     mutable ImVec2 UV;
+    mutable int Start, End;
+    mutable ImVec2 Corners[BatchSize*2];
+    mutable ImU32 Colors[BatchSize];
 };
 
 //-----------------------------------------------------------------------------
 // [SECTION] RenderPrimitives
 //-----------------------------------------------------------------------------
 
-/// Renders primitive shapes in bulk as efficiently as possible.
+// Maximum number of primitives rendered by each job of RenderPrimitivesParallel
+static const unsigned int PARALLEL_CHUNK_PRIMS = 16384;
+
+template <class _Renderer>
+struct RenderPrimitivesJob {
+    const _Renderer* Renderer;
+    ImDrawList*      DrawList;
+    ImRect           CullRect;
+    unsigned int     ChunkPrims;
+    int              VtxBase, IdxBase;
+    ImVector<int>    VtxUsed, IdxUsed;
+
+    // Renders one chunk into its own slice of the draw list's buffers, with indices relative to the start of the slice
+    static void Run(int chunk, void* data) {
+        RenderPrimitivesJob& job = *(RenderPrimitivesJob*)data;
+        const _Renderer renderer(*job.Renderer);
+        const unsigned int first = chunk * job.ChunkPrims;
+        const unsigned int last  = ImMin(first + job.ChunkPrims, (unsigned int)renderer.Prims);
+        ImDrawVert* vtx = job.DrawList->VtxBuffer.Data + job.VtxBase + first * renderer.VtxConsumed;
+        ImDrawIdx*  idx = job.DrawList->IdxBuffer.Data + job.IdxBase + first * renderer.IdxConsumed;
+        ImDrawList draw_list(job.DrawList->_Data);
+        draw_list.Flags        = job.DrawList->Flags;
+        draw_list._VtxWritePtr = vtx;
+        draw_list._IdxWritePtr = idx;
+        renderer.Init(draw_list);
+        renderer.Seek(first);
+        for (unsigned int i = first; i < last; ++i)
+            renderer.Render(draw_list, job.CullRect, i);
+        job.VtxUsed[chunk] = (int)(draw_list._VtxWritePtr - vtx);
+        job.IdxUsed[chunk] = (int)(draw_list._IdxWritePtr - idx);
+    }
+};
+
+// Renders primitive shapes in chunks with the ParallelFor callback, then compacts them, one draw command per chunk
+template <class _Renderer>
+void RenderPrimitivesParallel(const _Renderer& renderer, ImDrawList& draw_list, const ImRect& cull_rect) {
+    ImPlotContext& gp = *GImPlot;
+    RenderPrimitivesJob<_Renderer> job;
+    job.Renderer   = &renderer;
+    job.DrawList   = &draw_list;
+    job.CullRect   = cull_rect;
+    job.ChunkPrims = ImMin(PARALLEL_CHUNK_PRIMS, MaxIdx<ImDrawIdx>::Value / renderer.VtxConsumed);
+    job.VtxBase    = draw_list.VtxBuffer.Size;
+    job.IdxBase    = draw_list.IdxBuffer.Size;
+    const int chunks = (int)((renderer.Prims + job.ChunkPrims - 1) / job.ChunkPrims);
+    job.VtxUsed.resize(chunks);
+    job.IdxUsed.resize(chunks);
+    draw_list.VtxBuffer.resize(job.VtxBase + renderer.Prims * renderer.VtxConsumed);
+    draw_list.IdxBuffer.resize(job.IdxBase + renderer.Prims * renderer.IdxConsumed);
+    gp.ParallelFor(chunks, RenderPrimitivesJob<_Renderer>::Run, &job, gp.ParallelForData);
+    // stitch chunks together, removing the space left by culled primitives
+    int vtx_size = job.VtxBase;
+    int idx_size = job.IdxBase;
+    for (int c = 0; c < chunks; ++c) {
+        if (job.IdxUsed[c] == 0)
+            continue;
+        const int first = c * job.ChunkPrims;
+        memmove(draw_list.VtxBuffer.Data + vtx_size, draw_list.VtxBuffer.Data + job.VtxBase + first * renderer.VtxConsumed, job.VtxUsed[c] * sizeof(ImDrawVert));
+        memmove(draw_list.IdxBuffer.Data + idx_size, draw_list.IdxBuffer.Data + job.IdxBase + first * renderer.IdxConsumed, job.IdxUsed[c] * sizeof(ImDrawIdx));
+        draw_list.VtxBuffer.Size = vtx_size;
+        draw_list.IdxBuffer.Size = idx_size;
+        draw_list._CmdHeader.VtxOffset = vtx_size;
+        draw_list._OnChangedVtxOffset();
+        draw_list.CmdBuffer.back().ElemCount += job.IdxUsed[c];
+        draw_list._VtxCurrentIdx = job.VtxUsed[c];
+        vtx_size += job.VtxUsed[c];
+        idx_size += job.IdxUsed[c];
+    }
+    draw_list.VtxBuffer.Size = vtx_size;
+    draw_list.IdxBuffer.Size = idx_size;
+    draw_list._VtxWritePtr   = draw_list.VtxBuffer.Data + vtx_size;
+    draw_list._IdxWritePtr   = draw_list.IdxBuffer.Data + idx_size;
+}
+
+// Counts the primitives of a renderer in the current item's profile. Renderers emit a fixed number of vertices per
+// primitive, so those which emitted none were culled.
+static inline void ProfilePrimitives(unsigned int prims, int prims_rendered) {
+    ImPlotProfile& profile = GImPlot->ItemProfile;
+    profile.PrimsRendered += prims_rendered;
+    profile.PrimsCulled   += (int)prims - prims_rendered;
+}
+
+// Renders primitive shapes in bulk as efficiently as possible.
 template <class _Renderer>
 void RenderPrimitivesEx(const _Renderer& renderer, ImDrawList& draw_list, const ImRect& cull_rect) {
+    ImPlotContext& gp = *GImPlot;
+    const int vtx_start = draw_list.VtxBuffer.Size;
+    if (gp.ParallelFor != nullptr && renderer.Prims >= gp.ParallelMinPrims &&
+        ImHasFlag(draw_list.Flags, ImDrawListFlags_AllowVtxOffset) &&
+        (ImS64)renderer.Prims * ImMax(renderer.VtxConsumed, renderer.IdxConsumed) < INT_MAX - ImMax(draw_list.VtxBuffer.Size, draw_list.IdxBuffer.Size))
+    {
+        RenderPrimitivesParallel(renderer, draw_list, cull_rect);
+        if (gp.ItemProfile.Frame >= 0)
+            ProfilePrimitives(renderer.Prims, (draw_list.VtxBuffer.Size - vtx_start) / (int)renderer.VtxConsumed);
+        return;
+    }
     unsigned int prims        = renderer.Prims;
     unsigned int prims_culled = 0;
     unsigned int idx          = 0;
@@ -1394,6 +2971,8 @@ void RenderPrimitivesEx(const _Renderer& renderer, ImDrawList& draw_list, const
     }
     if (prims_culled > 0)
         draw_list.PrimUnreserve(prims_culled * renderer.IdxConsumed, prims_culled * renderer.VtxConsumed);
+    if (gp.ItemProfile.Frame >= 0)
+        ProfilePrimitives(renderer.Prims, (draw_list.VtxBuffer.Size - vtx_start) / (int)renderer.VtxConsumed);
 }
 
 template <template <class> class _Renderer, class _Getter, typename ...Args>
@@ -1418,7 +2997,7 @@ template <class _Getter>
 struct RendererMarkersFill : RendererBase {
     RendererMarkersFill(const _Getter& getter, const ImVec2* marker, int count, float size, ImU32 col) :
         RendererBase(getter.Count, (count-2)*3, count),
-        Getter(getter),
+        Points(getter, this->Transformer),
         Marker(marker),
         Count(count),
         Size(size),
@@ -1428,7 +3007,7 @@ struct RendererMarkersFill : RendererBase {
         UV = draw_list._Data->TexUvWhitePixel;
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 p = this->Transformer(Getter(prim));
+        ImVec2 p = Points(prim);
         if (p.x >= cull_rect.Min.x && p.y >= cull_rect.Min.y && p.x <= cull_rect.Max.x && p.y <= cull_rect.Max.y) {
             for (int i = 0; i < Count; i++) {
                 draw_list._VtxWritePtr[0].pos.x = p.x + Marker[i].x * Size;
@@ -1448,7 +3027,7 @@ struct RendererMarkersFill : RendererBase {
         }
         return false;
     }
-    const _Getter& Getter;
+    const TransformerBatch<_Getter> Points;
     const ImVec2* Marker;
     const int Count;
     const float Size;
@@ -1461,7 +3040,7 @@ template <class _Getter>
 struct RendererMarkersLine : RendererBase {
     RendererMarkersLine(const _Getter& getter, const ImVec2* marker, int count, float size, float weight, ImU32 col) :
         RendererBase(getter.Count, count/2*6, count/2*4),
-        Getter(getter),
+        Points(getter, this->Transformer),
         Marker(marker),
         Count(count),
         HalfWeight(ImMax(1.0f,weight)*0.5f),
@@ -1472,7 +3051,7 @@ struct RendererMarkersLine : RendererBase {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 p = this->Transformer(Getter(prim));
+        ImVec2 p = Points(prim);
         if (p.x >= cull_rect.Min.x && p.y >= cull_rect.Min.y && p.x <= cull_rect.Max.x && p.y <= cull_rect.Max.y) {
             for (int i = 0; i < Count; i = i + 2) {
                 ImVec2 p1(p.x + Marker[i].x * Size, p.y + Marker[i].y * Size);
@@ -1483,7 +3062,7 @@ struct RendererMarkersLine : RendererBase {
         }
         return false;
     }
-    const _Getter& Getter;
+    const TransformerBatch<_Getter> Points;
     const ImVec2* Marker;
     const int Count;
     mutable float HalfWeight;
@@ -1533,8 +3112,269 @@ static const ImVec2 MARKER_LINE_ASTERISK[6] = {ImVec2(-SQRT_3_2, -0.5f), ImVec2(
 static const ImVec2 MARKER_LINE_PLUS[4]     = {ImVec2(-1, 0), ImVec2(1, 0), ImVec2(0, -1), ImVec2(0, 1)};
 static const ImVec2 MARKER_LINE_CROSS[4]    = {ImVec2(-SQRT_1_2,-SQRT_1_2),ImVec2(SQRT_1_2,SQRT_1_2),ImVec2(SQRT_1_2,-SQRT_1_2),ImVec2(-SQRT_1_2,SQRT_1_2)};
 
+//-----------------------------------------------------------------------------
+// [SECTION] Marker Sprites
+//-----------------------------------------------------------------------------
+
+// Markers of small integer sizes are pre-rasterized into a custom rect of the font atlas, like ImGui's baked
+// anti-aliased lines, so that each one renders as a single textured quad instead of up to 40 vertices.
+// The rect holds one block per sprite (outlines of all markers, then fills of the closed ones), and each block
+// holds one cell of 2*size+4 pixels per size.
+
+static const int MARKER_SPRITE_MAX_SIZE = 8;
+static const int MARKER_SPRITE_FILLS    = ImPlotMarker_Cross;
+static const int MARKER_SPRITE_COUNT    = ImPlotMarker_COUNT + MARKER_SPRITE_FILLS;
+static const int MARKER_SPRITE_COLUMNS  = 4;
+static const int MARKER_SPRITE_BLOCK_W  = MARKER_SPRITE_MAX_SIZE * (MARKER_SPRITE_MAX_SIZE + 1) + 4 * MARKER_SPRITE_MAX_SIZE;
+static const int MARKER_SPRITE_BLOCK_H  = 2 * MARKER_SPRITE_MAX_SIZE + 4;
+static const int MARKER_SPRITE_RECT_W   = MARKER_SPRITE_COLUMNS * MARKER_SPRITE_BLOCK_W;
+static const int MARKER_SPRITE_RECT_H   = (MARKER_SPRITE_COUNT + MARKER_SPRITE_COLUMNS - 1) / MARKER_SPRITE_COLUMNS * MARKER_SPRITE_BLOCK_H;
+
+struct ImPlotMarkerShape {
+    const ImVec2* Points;
+    int           Count;
+};
+
+static const ImPlotMarkerShape MARKER_LINE_SHAPES[ImPlotMarker_COUNT] = {
+    {MARKER_LINE_CIRCLE,20}, {MARKER_LINE_SQUARE,8}, {MARKER_LINE_DIAMOND,8}, {MARKER_LINE_UP,6}, {MARKER_LINE_DOWN,6},
+    {MARKER_LINE_LEFT,6}, {MARKER_LINE_RIGHT,6}, {MARKER_LINE_CROSS,4}, {MARKER_LINE_PLUS,4}, {MARKER_LINE_ASTERISK,6}
+};
+
+static const ImPlotMarkerShape MARKER_FILL_SHAPES[MARKER_SPRITE_FILLS] = {
+    {MARKER_FILL_CIRCLE,10}, {MARKER_FILL_SQUARE,4}, {MARKER_FILL_DIAMOND,4}, {MARKER_FILL_UP,3}, {MARKER_FILL_DOWN,3},
+    {MARKER_FILL_LEFT,3}, {MARKER_FILL_RIGHT,3}
+};
+
+static inline int MarkerSpriteCellOffset(int size) {
+    return (size - 1) * size + 4 * (size - 1);
+}
+
+// Coverage of the pixel centered at #q (relative to the marker center) by a 1 pixel wide marker outline
+static float MarkerSpriteLineCoverage(const ImPlotMarkerShape& shape, float size, const ImVec2& q) {
+    float d = FLT_MAX;
+    for (int i = 0; i < shape.Count; i += 2) {
+        const ImVec2 p1 = shape.Points[i] * size;
+        const ImVec2 p2 = shape.Points[i+1] * size;
+        d = ImMin(d, ImLengthSqr(q - ImLineClosestPoint(p1, p2, q)));
+    }
+    return ImClamp(1.0f - ImSqrt(d), 0.0f, 1.0f);
+}
+
+// Coverage of the pixel centered at #q (relative to the marker center) by a convex marker fill
+static float MarkerSpriteFillCoverage(const ImPlotMarkerShape& shape, float size, const ImVec2& q) {
+    float area = 0;
+    for (int i = 0; i < shape.Count; ++i) {
+        const ImVec2& a = shape.Points[i];
+        const ImVec2& b = shape.Points[(i + 1) % shape.Count];
+        area += a.x * b.y - b.x * a.y;
+    }
+    const float orient = area > 0 ? 1.0f : -1.0f;
+    float sd = -FLT_MAX;
+    for (int i = 0; i < shape.Count; ++i) {
+        const ImVec2 a = shape.Points[i] * size;
+        const ImVec2 b = shape.Points[(i + 1) % shape.Count] * size;
+        const ImVec2 e = b - a;
+        const float len = ImSqrt(ImLengthSqr(e));
+        sd = ImMax(sd, orient * (e.x * (q.y - a.y) - e.y * (q.x - a.x)) / -len);
+    }
+    return ImClamp(0.5f - sd, 0.0f, 1.0f);
+}
+
+// Returns the custom rect of an atlas' marker sprites, or nullptr if it was lost or isn't packed
+static const ImFontAtlasCustomRect* GetMarkerSpriteRect(const ImFontAtlas* atlas, int rect_id) {
+    if (rect_id < 0 || rect_id >= atlas->CustomRects.Size)
+        return nullptr;
+    const ImFontAtlasCustomRect& r = atlas->CustomRects[rect_id];
+    if (r.Width != MARKER_SPRITE_RECT_W || r.Height != MARKER_SPRITE_RECT_H || r.GlyphID != 0 || !r.IsPacked())
+        return nullptr;
+    return &r;
+}
+
+static void RenderMarkerSpriteTexData(ImFontAtlas* atlas, int rect_id) {
+    const ImFontAtlasCustomRect* r = GetMarkerSpriteRect(atlas, rect_id);
+    if (r == nullptr)
+        return;
+    for (int k = 0; k < MARKER_SPRITE_COUNT; ++k) {
+        const bool fill = k >= ImPlotMarker_COUNT;
+        const ImPlotMarkerShape& shape = fill ? MARKER_FILL_SHAPES[k - ImPlotMarker_COUNT] : MARKER_LINE_SHAPES[k];
+        const int bx = r->X + (k % MARKER_SPRITE_COLUMNS) * MARKER_SPRITE_BLOCK_W;
+        const int by = r->Y + (k / MARKER_SPRITE_COLUMNS) * MARKER_SPRITE_BLOCK_H;
+        for (int s = 1; s <= MARKER_SPRITE_MAX_SIZE; ++s) {
+            const int cell = 2 * s + 4;
+            const int cx = bx + MarkerSpriteCellOffset(s);
+            for (int y = 0; y < cell; ++y) {
+                for (int x = 0; x < cell; ++x) {
+                    const ImVec2 q(x + 0.5f - cell * 0.5f, y + 0.5f - cell * 0.5f);
+                    const float cov = fill ? MarkerSpriteFillCoverage(shape, (float)s, q) : MarkerSpriteLineCoverage(shape, (float)s, q);
+                    const unsigned char alpha = (unsigned char)(cov * 255.0f + 0.5f);
+                    const int i = (by + y) * atlas->TexWidth + cx + x;
+                    if (atlas->TexPixelsAlpha8 != nullptr)
+                        atlas->TexPixelsAlpha8[i] = alpha;
+                    else
+                        atlas->TexPixelsRGBA32[i] = IM_COL32(255, 255, 255, alpha);
+                }
+            }
+        }
+    }
+}
+
+static bool BuildFontAtlasWithMarkerSprites(ImFontAtlas* atlas) {
+    ImPlotMarkerSprites& ms = *(ImPlotMarkerSprites*)atlas->FontBuilderIO;
+    if (atlas != ms.Atlas) {
+        // the hook was copied to another atlas, restore the builder it replaced
+        atlas->FontBuilderIO = ms.BaseIO;
+        return atlas->Build();
+    }
+    if (ms.Orphaned) {
+        // the context is gone, so nobody renders the sprites anymore
+        atlas->FontBuilderIO = ms.BaseIO;
+        IM_DELETE(&ms);
+        return atlas->Build();
+    }
+    // custom rects are lost when the atlas input data is cleared
+    if (ms.RectId < 0 || ms.RectId >= atlas->CustomRects.Size || atlas->CustomRects[ms.RectId].Width != MARKER_SPRITE_RECT_W || atlas->CustomRects[ms.RectId].Height != MARKER_SPRITE_RECT_H)
+        ms.RectId = atlas->AddCustomRectRegular(MARKER_SPRITE_RECT_W, MARKER_SPRITE_RECT_H);
+    atlas->FontBuilderIO = ms.BaseIO;
+    const bool ret = atlas->Build();
+    atlas->FontBuilderIO = &ms.IO;
+    if (ret)
+        RenderMarkerSpriteTexData(atlas, ms.RectId);
+    return ret;
+}
+
+void AddFontAtlasMarkerSprites(ImFontAtlas* atlas, ImPlotContext* ctx) {
+    if (ctx == nullptr)
+        ctx = GImPlot;
+    IM_ASSERT_USER_ERROR(ctx != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    if (atlas == nullptr || atlas->IsBuilt() || ImHasFlag(atlas->Flags, ImFontAtlasFlags_NoBakedLines))
+        return;
+    // only one hook per atlas, so that each one restores the builder the atlas had before
+    if (atlas->FontBuilderIO != nullptr && atlas->FontBuilderIO->FontBuilder_Build == BuildFontAtlasWithMarkerSprites) {
+        ImPlotMarkerSprites* prev = (ImPlotMarkerSprites*)atlas->FontBuilderIO;
+        if (prev->Atlas == atlas && !prev->Orphaned)
+            return;
+        atlas->FontBuilderIO = prev->BaseIO;
+        if (prev->Atlas == atlas)
+            IM_DELETE(prev);
+    }
+    RemoveFontAtlasMarkerSprites(ctx);
+    ImPlotMarkerSprites* ms = IM_NEW(ImPlotMarkerSprites)();
+    ms->IO.FontBuilder_Build = BuildFontAtlasWithMarkerSprites;
+    ms->BaseIO = atlas->FontBuilderIO;
+    ms->Atlas  = atlas;
+    atlas->FontBuilderIO = &ms->IO;
+    ctx->MarkerSprites = ms;
+}
+
+void RemoveFontAtlasMarkerSprites(ImPlotContext* ctx) {
+    if (ctx == nullptr)
+        ctx = GImPlot;
+    if (ctx == nullptr || ctx->MarkerSprites == nullptr)
+        return;
+    ImPlotMarkerSprites* ms = ctx->MarkerSprites;
+    ctx->MarkerSprites = nullptr;
+    // the atlas is only known to be alive while it belongs to the current ImGui context. Otherwise the hook
+    // is left installed, so the atlas never points to freed memory, and it unhooks itself on the next build.
+    if (ImGui::GetCurrentContext() != nullptr && ImGui::GetIO().Fonts == ms->Atlas) {
+        if (ms->Atlas->FontBuilderIO == &ms->IO)
+            ms->Atlas->FontBuilderIO = ms->BaseIO;
+        IM_DELETE(ms);
+    }
+    else {
+        ms->Orphaned = true;
+    }
+}
+
+// Gets the texture coordinates of a marker sprite, if one was baked for the marker's size and weight and can be used by #draw_list
+static bool GetMarkerSpriteUV(const ImDrawList& draw_list, ImPlotMarker marker, bool fill, float size, float weight, ImVec2& uv0, ImVec2& uv1) {
+    if (GImPlot->MarkerSprites == nullptr)
+        return false;
+    const ImPlotMarkerSprites& ms = *GImPlot->MarkerSprites;
+    const int s = (int)(size + 0.5f);
+    if (s < 1 || s > MARKER_SPRITE_MAX_SIZE || ImAbs(size - s) > 0.01f || (!fill && weight > 1.0f) || (fill && marker >= MARKER_SPRITE_FILLS))
+        return false;
+    // the atlas may have been freed and another allocated at its address, which only has sprites if it was hooked
+    if (!ImHasFlag(draw_list.Flags, ImDrawListFlags_AntiAliasedLinesUseTex) || ms.Atlas == nullptr || ImGui::GetIO().Fonts != ms.Atlas)
+        return false;
+    if (ms.Atlas->FontBuilderIO != &ms.IO || !ms.Atlas->IsBuilt() || draw_list._CmdHeader.TextureId != ms.Atlas->TexID)
+        return false;
+    const ImFontAtlasCustomRect* rect = GetMarkerSpriteRect(ms.Atlas, ms.RectId);
+    if (rect == nullptr)
+        return false;
+    const ImFontAtlasCustomRect& r = *rect;
+    const int k = fill ? ImPlotMarker_COUNT + marker : marker;
+    const int cell = 2 * s + 4;
+    const ImVec2 p0((float)(r.X + (k % MARKER_SPRITE_COLUMNS) * MARKER_SPRITE_BLOCK_W + MarkerSpriteCellOffset(s)), (float)(r.Y + (k / MARKER_SPRITE_COLUMNS) * MARKER_SPRITE_BLOCK_H));
+    uv0 = p0 * ms.Atlas->TexUvScale;
+    uv1 = (p0 + ImVec2((float)cell, (float)cell)) * ms.Atlas->TexUvScale;
+    return true;
+}
+
+template <class _Getter>
+struct RendererMarkersSprite : RendererBase {
+    RendererMarkersSprite(const _Getter& getter, float size, const ImVec2& uv0, const ImVec2& uv1, ImU32 col) :
+        RendererBase(getter.Count, 6, 4),
+        Points(getter, this->Transformer),
+        HalfSize(size + 2),
+        UV0(uv0),
+        UV1(uv1),
+        Col(col)
+    { }
+    void Init(ImDrawList&) const { }
+    IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
+        ImVec2 p = Points(prim);
+        if (p.x >= cull_rect.Min.x && p.y >= cull_rect.Min.y && p.x <= cull_rect.Max.x && p.y <= cull_rect.Max.y) {
+            draw_list._VtxWritePtr[0].pos.x = p.x - HalfSize;
+            draw_list._VtxWritePtr[0].pos.y = p.y - HalfSize;
+            draw_list._VtxWritePtr[0].uv    = UV0;
+            draw_list._VtxWritePtr[0].col   = Col;
+            draw_list._VtxWritePtr[1].pos.x = p.x + HalfSize;
+            draw_list._VtxWritePtr[1].pos.y = p.y - HalfSize;
+            draw_list._VtxWritePtr[1].uv.x  = UV1.x;
+            draw_list._VtxWritePtr[1].uv.y  = UV0.y;
+            draw_list._VtxWritePtr[1].col   = Col;
+            draw_list._VtxWritePtr[2].pos.x = p.x + HalfSize;
+            draw_list._VtxWritePtr[2].pos.y = p.y + HalfSize;
+            draw_list._VtxWritePtr[2].uv    = UV1;
+            draw_list._VtxWritePtr[2].col   = Col;
+            draw_list._VtxWritePtr[3].pos.x = p.x - HalfSize;
+            draw_list._VtxWritePtr[3].pos.y = p.y + HalfSize;
+            draw_list._VtxWritePtr[3].uv.x  = UV0.x;
+            draw_list._VtxWritePtr[3].uv.y  = UV1.y;
+            draw_list._VtxWritePtr[3].col   = Col;
+            draw_list._VtxWritePtr += 4;
+            draw_list._IdxWritePtr[0] = (ImDrawIdx)(draw_list._VtxCurrentIdx);
+            draw_list._IdxWritePtr[1] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 1);
+            draw_list._IdxWritePtr[2] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 2);
+            draw_list._IdxWritePtr[3] = (ImDrawIdx)(draw_list._VtxCurrentIdx);
+            draw_list._IdxWritePtr[4] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 2);
+            draw_list._IdxWritePtr[5] = (ImDrawIdx)(draw_list._VtxCurrentIdx + 3);
+            draw_list._IdxWritePtr += 6;
+            draw_list._VtxCurrentIdx += 4;
+            return true;
+        }
+        return false;
+    }
+    const TransformerBatch<_Getter> Points;
+    const float HalfSize;
+    const ImVec2 UV0;
+    const ImVec2 UV1;
+    const ImU32 Col;
+};
+
 template <typename _Getter>
 void RenderMarkers(const _Getter& getter, ImPlotMarker marker, float size, bool rend_fill, ImU32 col_fill, bool rend_line, ImU32 col_line, float weight) {
+    // use baked sprites when available, and geometry otherwise (e.g. for large markers)
+    ImDrawList& draw_list = *GetPlotDrawList();
+    ImVec2 uv0, uv1;
+    if (rend_fill && GetMarkerSpriteUV(draw_list, marker, true, size, weight, uv0, uv1)) {
+        RenderPrimitives1<RendererMarkersSprite>(getter, size, uv0, uv1, col_fill);
+        rend_fill = false;
+    }
+    if (rend_line && GetMarkerSpriteUV(draw_list, marker, false, size, weight, uv0, uv1)) {
+        RenderPrimitives1<RendererMarkersSprite>(getter, size, uv0, uv1, col_line);
+        rend_line = false;
+    }
     if (rend_fill) {
         switch (marker) {
             case ImPlotMarker_Circle  : RenderPrimitives1<RendererMarkersFill>(getter,MARKER_FILL_CIRCLE,10,size,col_fill); break;
@@ -1566,89 +3406,327 @@ void RenderMarkers(const _Getter& getter, ImPlotMarker marker, float size, bool
 // [SECTION] PlotLine
 //-----------------------------------------------------------------------------
 
+// Reduces a getter with ascending X to its first, min, max and last point in each pixel column of the current plot
 template <typename _Getter>
-void PlotLineEx(const char* label_id, const _Getter& getter, ImPlotLineFlags flags) {
-    if (BeginItemEx(label_id, Fitter1<_Getter>(getter), flags, ImPlotCol_Line)) {
-        if (getter.Count <= 0) {
-            EndItem();
-            return;
-        }
-        const ImPlotNextItemData& s = GetItemData();
-        if (getter.Count > 1) {
-            if (ImHasFlag(flags, ImPlotLineFlags_Shaded) && s.RenderFill) {
-                const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
-                GetterOverrideY<_Getter> getter2(getter, 0);
-                RenderPrimitives2<RendererShaded>(getter,getter2,col_fill);
-            }
-            if (s.RenderLine) {
-                const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
-                if (ImHasFlag(flags,ImPlotLineFlags_Segments)) {
-                    RenderPrimitives1<RendererLineSegments1>(getter,col_line,s.LineWeight);
-                }
-                else if (ImHasFlag(flags, ImPlotLineFlags_Loop)) {
-                    if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
-                        RenderPrimitives1<RendererLineStripSkip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
-                    else
-                        RenderPrimitives1<RendererLineStrip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
+struct GetterM4 {
+    GetterM4(const _Getter& getter, ImVector<ImPlotPoint>& buffer) {
+        Downsample(getter, buffer);
+        Data  = buffer.Data;
+        Count = buffer.Size;
+    }
+    template <typename I> IMPLOT_INLINE ImPlotPoint operator()(I idx) const {
+        return Data[idx];
+    }
+    static void Downsample(const _Getter& getter, ImVector<ImPlotPoint>& out) {
+        ImPlotPlot& plot = *GImPlot->CurrentPlot;
+        const Transformer1 tx = Transformer2(plot).Tx;
+        // everything left or right of the plot collapses into a single column on either side
+        const float pix_min = plot.PlotRect.Min.x - 1;
+        const float pix_max = plot.PlotRect.Max.x + 1;
+        out.resize(0);
+        out.reserve(ImMin(getter.Count, 4 * ((int)(pix_max - pix_min) + 1)));
+        // bin slots: 0 = first, 1 = min, 2 = max, 3 = last
+        int         idx[4] = {0,0,0,0};
+        ImPlotPoint pts[4];
+        int  col  = 0;
+        bool open = false;
+        ImPlotPoint block[GETTER_BATCH_SIZE];
+        for (int b = 0; b < getter.Count; b += GETTER_BATCH_SIZE) {
+            const int n = ImMin(GETTER_BATCH_SIZE, getter.Count - b);
+            GetPoints(getter, b, n, block);
+            for (int i = b; i < b + n; ++i) {
+                const ImPlotPoint p = block[i - b];
+                const float px = tx(p.x);
+                if (ImNan(px) || ImNan(p.y)) {
+                    // keep gaps intact so that missing data renders the same way it would without downsampling
+                    if (open)
+                        Flush(out, idx, pts);
+                    open = false;
+                    out.push_back(p);
+                    continue;
                 }
-                else {
-                    if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
-                        RenderPrimitives1<RendererLineStripSkip>(getter,col_line,s.LineWeight);
-                    else
-                        RenderPrimitives1<RendererLineStrip>(getter,col_line,s.LineWeight);
+                const int c = (int)ImFloor(ImClamp(px, pix_min, pix_max));
+                if (!open || c != col) {
+                    if (open)
+                        Flush(out, idx, pts);
+                    col  = c;
+                    open = true;
+                    idx[0] = idx[1] = idx[2] = idx[3] = i;
+                    pts[0] = pts[1] = pts[2] = pts[3] = p;
+                    continue;
                 }
+                if (p.y < pts[1].y) { idx[1] = i; pts[1] = p; }
+                if (p.y > pts[2].y) { idx[2] = i; pts[2] = p; }
+                idx[3] = i;
+                pts[3] = p;
             }
         }
-        // render markers
-        if (s.Marker != ImPlotMarker_None) {
-            if (ImHasFlag(flags, ImPlotLineFlags_NoClip)) {
-                PopPlotClipRect();
-                PushPlotClipRect(s.MarkerSize);
+        if (open)
+            Flush(out, idx, pts);
+    }
+    static IMPLOT_INLINE void Flush(ImVector<ImPlotPoint>& out, int* idx, ImPlotPoint* pts) {
+        // min and max are emitted in the order they occurred to preserve the shape of the line
+        if (idx[1] > idx[2]) {
+            ImSwap(idx[1], idx[2]);
+            ImSwap(pts[1], pts[2]);
+        }
+        out.push_back(pts[0]);
+        for (int k = 1; k < 4; ++k) {
+            if (idx[k] != idx[k-1])
+                out.push_back(pts[k]);
+        }
+    }
+    const ImPlotPoint* Data;
+    int Count;
+};
+
+template <typename _Getter>
+void RenderLineItem(const _Getter& getter, ImPlotLineFlags flags) {
+    const ImPlotNextItemData& s = GetItemData();
+    if (getter.Count > 1) {
+        if (ImHasFlag(flags, ImPlotLineFlags_Shaded) && s.RenderFill) {
+            const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
+            GetterOverrideY<_Getter> getter2(getter, 0);
+            RenderPrimitives2<RendererShaded>(getter,getter2,col_fill);
+        }
+        if (s.RenderLine) {
+            const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
+            if (ImHasFlag(flags,ImPlotLineFlags_Segments)) {
+                RenderPrimitives1<RendererLineSegments1>(getter,col_line,s.LineWeight);
             }
-            const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
-            const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
-            RenderMarkers<_Getter>(getter, s.Marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+            else if (ImHasFlag(flags, ImPlotLineFlags_Loop)) {
+                if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
+                    RenderPrimitives1<RendererLineStripSkip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
+                else
+                    RenderPrimitives1<RendererLineStrip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
+            }
+            else {
+                if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
+                    RenderPrimitives1<RendererLineStripSkip>(getter,col_line,s.LineWeight);
+                else
+                    RenderPrimitives1<RendererLineStrip>(getter,col_line,s.LineWeight);
+            }
+        }
+    }
+    // render markers
+    if (s.Marker != ImPlotMarker_None) {
+        if (ImHasFlag(flags, ImPlotLineFlags_NoClip)) {
+            PopPlotClipRect();
+            PushPlotClipRect(s.MarkerSize);
         }
+        const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
+        const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
+        RenderMarkers<_Getter>(getter, s.Marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+    }
+}
+
+template <typename _Getter>
+void PlotLineEx(const char* label_id, const _Getter& getter, ImPlotLineFlags flags) {
+    if (BeginItemEx(label_id, Fitter1<_Getter>(getter,flags), flags, ImPlotCol_Line)) {
+        if (getter.Count <= 0) {
+            EndItem();
+            return;
+        }
+        // segments and loops depend on the full index range, so they can neither be sliced nor downsampled
+        const bool strip = !ImHasFlag(flags, ImPlotLineFlags_Segments) && !ImHasFlag(flags, ImPlotLineFlags_Loop);
+        const GetterSlice<_Getter> visible = SliceVisibleX(getter, strip && ImHasFlag(flags, ImPlotItemFlags_SortedX));
+        if (strip && ImHasFlag(flags, ImPlotLineFlags_Downsample))
+            RenderLineItem(GetterM4<GetterSlice<_Getter>>(visible, GImPlot->TempPoint1), flags);
+        else
+            RenderLineItem(visible, flags);
         EndItem();
     }
 }
 
 template <typename T>
 void PlotLine(const char* label_id, const T* values, int count, double xscale, double x0, ImPlotLineFlags flags, int offset, int stride) {
+    SetItemCacheKey(flags, "PlotLine", values, count, xscale, x0, flags, offset, stride, sizeof(T));
     GetterXY<IndexerLin,IndexerIdx<T>> getter(IndexerLin(xscale,x0),IndexerIdx<T>(values,count,offset,stride),count);
     PlotLineEx(label_id, getter, flags);
 }
 
 template <typename T>
 void PlotLine(const char* label_id, const T* xs, const T* ys, int count, ImPlotLineFlags flags, int offset, int stride) {
+    SetItemCacheKey(flags, "PlotLine", xs, ys, count, flags, offset, stride, sizeof(T));
     GetterXY<IndexerIdx<T>,IndexerIdx<T>> getter(IndexerIdx<T>(xs,count,offset,stride),IndexerIdx<T>(ys,count,offset,stride),count);
     PlotLineEx(label_id, getter, flags);
 }
 
+template <typename T>
+void PlotLineRing(const char* label_id, const T* xs, const T* ys, int capacity, int head, int size, ImPlotLineFlags flags, int stride) {
+    SetItemCacheKey(flags, "PlotLineRing", xs, ys, capacity, head, size, flags, stride, sizeof(T));
+    IndexerRing<T> indexer_x(xs,capacity,head,size,stride);
+    IndexerRing<T> indexer_y(ys,capacity,head,size,stride);
+    GetterXY<IndexerRing<T>,IndexerRing<T>> getter(indexer_x,indexer_y,indexer_x.Count);
+    PlotLineEx(label_id, getter, flags);
+}
+
 #define INSTANTIATE_MACRO(T) \
     template IMPLOT_API void PlotLine<T> (const char* label_id, const T* values, int count, double xscale, double x0, ImPlotLineFlags flags, int offset, int stride); \
-    template IMPLOT_API void PlotLine<T>(const char* label_id, const T* xs, const T* ys, int count, ImPlotLineFlags flags, int offset, int stride);
+    template IMPLOT_API void PlotLine<T>(const char* label_id, const T* xs, const T* ys, int count, ImPlotLineFlags flags, int offset, int stride); \
+    template IMPLOT_API void PlotLineRing<T>(const char* label_id, const T* xs, const T* ys, int capacity, int head, int size, ImPlotLineFlags flags, int stride);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
 // custom
 void PlotLineG(const char* label_id, ImPlotGetter getter_func, void* data, int count, ImPlotLineFlags flags) {
+    SetItemCacheKey(flags, "PlotLineG", getter_func, data, count, flags);
     GetterFuncPtr getter(getter_func,data, count);
     PlotLineEx(label_id, getter, flags);
 }
 
+void PlotLineG(const char* label_id, ImPlotBatchGetter getter_func, void* data, int count, ImPlotLineFlags flags) {
+    SetItemCacheKey(flags, "PlotLineG", getter_func, data, count, flags);
+    GetterBatchPtr getter(getter_func,data, count);
+    PlotLineEx(label_id, getter, flags);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotScatter
 //-----------------------------------------------------------------------------
 
+// Number of points binned by each job of BinScatterDensity, and maximum number of jobs (each job has its own grid)
+static const int DENSITY_JOB_POINTS = 262144;
+static const int DENSITY_MAX_JOBS   = 8;
+
+template <typename _Getter>
+struct ScatterDensityJob {
+    const _Getter*      Getter;
+    const Transformer2* Transformer;
+    ImRect              Rect;
+    int                 Cols, Rows, Jobs;
+    int*                Counts; // Jobs grids of Cols*Rows bins
+
+    static void Run(int job, void* data) {
+        const ScatterDensityJob& self = *(const ScatterDensityJob*)data;
+        const int first = (int)((ImS64)self.Getter->Count * job / self.Jobs);
+        const int last  = (int)((ImS64)self.Getter->Count * (job + 1) / self.Jobs);
+        int* counts = self.Counts + (size_t)job * self.Cols * self.Rows;
+        ImPlotPoint plt[TRANSFORM_BATCH_SIZE];
+        ImVec2 pix[TRANSFORM_BATCH_SIZE];
+        for (int i = first; i < last; i += TRANSFORM_BATCH_SIZE) {
+            const int n = ImMin(TRANSFORM_BATCH_SIZE, last - i);
+            GetPoints(*self.Getter, i, n, plt);
+            (*self.Transformer)(plt, pix, n);
+            for (int j = 0; j < n; ++j) {
+                // written so that NaNs fail the test
+                if (pix[j].x >= self.Rect.Min.x && pix[j].x < self.Rect.Max.x && pix[j].y >= self.Rect.Min.y && pix[j].y < self.Rect.Max.y) {
+                    const int c = ImMin((int)(pix[j].x - self.Rect.Min.x), self.Cols - 1);
+                    const int r = ImMin((int)(pix[j].y - self.Rect.Min.y), self.Rows - 1);
+                    counts[r * self.Cols + c]++;
+                }
+            }
+        }
+    }
+};
+
+// Counts the points of #getter that fall into each pixel of the plot area, in parallel if a ParallelFor callback is set.
+// Returns the grid (row major, top to bottom) and its maximum count.
+template <typename _Getter>
+int* BinScatterDensity(const _Getter& getter, int cols, int rows, int& max_count) {
+    ImPlotContext& gp = *GImPlot;
+    const Transformer2 transformer;
+    const int cells = cols * rows;
+    int jobs = 1;
+    if (gp.ParallelFor != nullptr && getter.Count >= gp.ParallelMinPrims)
+        jobs = ImClamp(getter.Count / DENSITY_JOB_POINTS, 1, DENSITY_MAX_JOBS);
+    ImVector<int>& counts = gp.TempInt1;
+    counts.resize(cells * jobs);
+    memset(counts.Data, 0, counts.size_in_bytes());
+    ScatterDensityJob<_Getter> job;
+    job.Getter      = &getter;
+    job.Transformer = &transformer;
+    job.Rect        = ImRect(gp.CurrentPlot->PlotRect.Min, gp.CurrentPlot->PlotRect.Min + ImVec2((float)cols, (float)rows));
+    job.Cols        = cols;
+    job.Rows        = rows;
+    job.Jobs        = jobs;
+    job.Counts      = counts.Data;
+    if (jobs > 1)
+        gp.ParallelFor(jobs, ScatterDensityJob<_Getter>::Run, &job, gp.ParallelForData);
+    else
+        ScatterDensityJob<_Getter>::Run(0, &job);
+    max_count = 0;
+    for (int i = 0; i < cells; ++i) {
+        for (int j = 1; j < jobs; ++j)
+            counts.Data[i] += counts.Data[j * cells + i];
+        max_count = ImMax(max_count, counts.Data[i]);
+    }
+    return counts.Data;
+}
+
+// Colors the bins of a density grid with the current colormap on a log scale. Empty bins are transparent.
+struct GetterDensity {
+    GetterDensity(const int* counts, int cols, int rows, int max_count, const double* xs, const double* ys) :
+        Counts(counts),
+        Count(cols*rows),
+        Cols(cols),
+        Xs(xs),
+        Ys(ys),
+        InvLogMax(1.0f / ImLog(1.0f + (float)max_count))
+    { }
+    template <typename I> IMPLOT_INLINE RectC operator()(I idx) const {
+        const int r = idx / Cols;
+        const int c = idx % Cols;
+        RectC rect;
+        rect.Pos      = ImPlotPoint((Xs[c] + Xs[c+1]) * 0.5, (Ys[r] + Ys[r+1]) * 0.5);
+        rect.HalfSize = ImPlotPoint((Xs[c+1] - Xs[c]) * 0.5, (Ys[r+1] - Ys[r]) * 0.5);
+        if (Counts[idx] == 0) {
+            rect.Color = 0;
+        }
+        else {
+            ImPlotContext& gp = *GImPlot;
+            rect.Color = gp.ColormapData.LerpTable(gp.Style.Colormap, ImLog(1.0f + (float)Counts[idx]) * InvLogMax);
+        }
+        return rect;
+    }
+    const int* const Counts;
+    const int Count, Cols;
+    const double* const Xs;
+    const double* const Ys;
+    const float InvLogMax;
+};
+
+template <typename _Getter>
+void RenderScatterDensity(const _Getter& getter) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotPlot& plot = *gp.CurrentPlot;
+    const int cols = (int)plot.PlotRect.GetWidth();
+    const int rows = (int)plot.PlotRect.GetHeight();
+    if (cols <= 0 || rows <= 0)
+        return;
+    int max_count;
+    const int* counts = BinScatterDensity(getter, cols, rows, max_count);
+    if (max_count == 0)
+        return;
+    // plot coordinates of the bin edges, so that bins line up with pixels for any axis scale
+    const ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+    const ImPlotAxis& y_axis = plot.Axes[plot.CurrentY];
+    ImVector<double>& xs = gp.TempDouble1;
+    ImVector<double>& ys = gp.TempDouble2;
+    xs.resize(cols + 1);
+    ys.resize(rows + 1);
+    for (int c = 0; c <= cols; ++c)
+        xs[c] = x_axis.PixelsToPlot(plot.PlotRect.Min.x + c);
+    for (int r = 0; r <= rows; ++r)
+        ys[r] = y_axis.PixelsToPlot(plot.PlotRect.Min.y + r);
+    GetterDensity density(counts, cols, rows, max_count, xs.Data, ys.Data);
+    RenderPrimitives1<RendererRectC>(density);
+}
+
 template <typename Getter>
 void PlotScatterEx(const char* label_id, const Getter& getter, ImPlotScatterFlags flags) {
-    if (BeginItemEx(label_id, Fitter1<Getter>(getter), flags, ImPlotCol_MarkerOutline)) {
+    if (BeginItemEx(label_id, Fitter1<Getter>(getter,flags), flags, ImPlotCol_MarkerOutline)) {
         if (getter.Count <= 0) {
             EndItem();
             return;
         }
         const ImPlotNextItemData& s = GetItemData();
+        const GetterSlice<Getter> visible = SliceVisibleX(getter, ImHasFlag(flags, ImPlotItemFlags_SortedX));
+        if (ImHasFlag(flags, ImPlotScatterFlags_Density)) {
+            RenderScatterDensity(visible);
+            EndItem();
+            return;
+        }
         ImPlotMarker marker = s.Marker == ImPlotMarker_None ? ImPlotMarker_Circle: s.Marker;
         if (marker != ImPlotMarker_None) {
             if (ImHasFlag(flags,ImPlotScatterFlags_NoClip)) {
@@ -1657,7 +3735,7 @@ void PlotScatterEx(const char* label_id, const Getter& getter, ImPlotScatterFlag
             }
             const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
             const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
-            RenderMarkers<Getter>(getter, marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+            RenderMarkers<GetterSlice<Getter>>(visible, marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
         }
         EndItem();
     }
@@ -1665,54 +3743,74 @@ void PlotScatterEx(const char* label_id, const Getter& getter, ImPlotScatterFlag
 
 template <typename T>
 void PlotScatter(const char* label_id, const T* values, int count, double xscale, double x0, ImPlotScatterFlags flags, int offset, int stride) {
+    SetItemCacheKey(flags, "PlotScatter", values, count, xscale, x0, flags, offset, stride, sizeof(T));
     GetterXY<IndexerLin,IndexerIdx<T>> getter(IndexerLin(xscale,x0),IndexerIdx<T>(values,count,offset,stride),count);
     PlotScatterEx(label_id, getter, flags);
 }
 
 template <typename T>
 void PlotScatter(const char* label_id, const T* xs, const T* ys, int count, ImPlotScatterFlags flags, int offset, int stride) {
+    SetItemCacheKey(flags, "PlotScatter", xs, ys, count, flags, offset, stride, sizeof(T));
     GetterXY<IndexerIdx<T>,IndexerIdx<T>> getter(IndexerIdx<T>(xs,count,offset,stride),IndexerIdx<T>(ys,count,offset,stride),count);
     return PlotScatterEx(label_id, getter, flags);
 }
 
+template <typename T>
+void PlotScatterRing(const char* label_id, const T* xs, const T* ys, int capacity, int head, int size, ImPlotScatterFlags flags, int stride) {
+    SetItemCacheKey(flags, "PlotScatterRing", xs, ys, capacity, head, size, flags, stride, sizeof(T));
+    IndexerRing<T> indexer_x(xs,capacity,head,size,stride);
+    IndexerRing<T> indexer_y(ys,capacity,head,size,stride);
+    GetterXY<IndexerRing<T>,IndexerRing<T>> getter(indexer_x,indexer_y,indexer_x.Count);
+    return PlotScatterEx(label_id, getter, flags);
+}
+
 #define INSTANTIATE_MACRO(T) \
     template IMPLOT_API void PlotScatter<T>(const char* label_id, const T* values, int count, double xscale, double x0, ImPlotScatterFlags flags, int offset, int stride); \
-    template IMPLOT_API void PlotScatter<T>(const char* label_id, const T* xs, const T* ys, int count, ImPlotScatterFlags flags, int offset, int stride);
+    template IMPLOT_API void PlotScatter<T>(const char* label_id, const T* xs, const T* ys, int count, ImPlotScatterFlags flags, int offset, int stride); \
+    template IMPLOT_API void PlotScatterRing<T>(const char* label_id, const T* xs, const T* ys, int capacity, int head, int size, ImPlotScatterFlags flags, int stride);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
 // custom
 void PlotScatterG(const char* label_id, ImPlotGetter getter_func, void* data, int count, ImPlotScatterFlags flags) {
+    SetItemCacheKey(flags, "PlotScatterG", getter_func, data, count, flags);
     GetterFuncPtr getter(getter_func,data, count);
     return PlotScatterEx(label_id, getter, flags);
 }
 
+void PlotScatterG(const char* label_id, ImPlotBatchGetter getter_func, void* data, int count, ImPlotScatterFlags flags) {
+    SetItemCacheKey(flags, "PlotScatterG", getter_func, data, count, flags);
+    GetterBatchPtr getter(getter_func,data, count);
+    return PlotScatterEx(label_id, getter, flags);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotStairs
 //-----------------------------------------------------------------------------
 
 template <typename Getter>
 void PlotStairsEx(const char* label_id, const Getter& getter, ImPlotStairsFlags flags) {
-    if (BeginItemEx(label_id, Fitter1<Getter>(getter), flags, ImPlotCol_Line)) {
+    if (BeginItemEx(label_id, Fitter1<Getter>(getter,flags), flags, ImPlotCol_Line)) {
         if (getter.Count <= 0) {
             EndItem();
             return;
         }
         const ImPlotNextItemData& s = GetItemData();
+        const GetterSlice<Getter> visible = SliceVisibleX(getter, ImHasFlag(flags, ImPlotItemFlags_SortedX));
         if (getter.Count > 1) {
             if (s.RenderFill && ImHasFlag(flags,ImPlotStairsFlags_Shaded)) {
                 const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
                 if (ImHasFlag(flags, ImPlotStairsFlags_PreStep))
-                    RenderPrimitives1<RendererStairsPreShaded>(getter,col_fill);
+                    RenderPrimitives1<RendererStairsPreShaded>(visible,col_fill);
                 else
-                    RenderPrimitives1<RendererStairsPostShaded>(getter,col_fill);
+                    RenderPrimitives1<RendererStairsPostShaded>(visible,col_fill);
             }
             if (s.RenderLine) {
                 const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
                 if (ImHasFlag(flags, ImPlotStairsFlags_PreStep))
-                    RenderPrimitives1<RendererStairsPre>(getter,col_line,s.LineWeight);
+                    RenderPrimitives1<RendererStairsPre>(visible,col_line,s.LineWeight);
                 else
-                    RenderPrimitives1<RendererStairsPost>(getter,col_line,s.LineWeight);
+                    RenderPrimitives1<RendererStairsPost>(visible,col_line,s.LineWeight);
             }
         }
         // render markers
@@ -1721,7 +3819,7 @@ void PlotStairsEx(const char* label_id, const Getter& getter, ImPlotStairsFlags
             PushPlotClipRect(s.MarkerSize);
             const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
             const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
-            RenderMarkers<Getter>(getter, s.Marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+            RenderMarkers<GetterSlice<Getter>>(visible, s.Marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
         }
         EndItem();
     }
@@ -1729,43 +3827,138 @@ void PlotStairsEx(const char* label_id, const Getter& getter, ImPlotStairsFlags
 
 template <typename T>
 void PlotStairs(const char* label_id, const T* values, int count, double xscale, double x0, ImPlotStairsFlags flags, int offset, int stride) {
+    SetItemCacheKey(flags, "PlotStairs", values, count, xscale, x0, flags, offset, stride, sizeof(T));
     GetterXY<IndexerLin,IndexerIdx<T>> getter(IndexerLin(xscale,x0),IndexerIdx<T>(values,count,offset,stride),count);
     PlotStairsEx(label_id, getter, flags);
 }
 
 template <typename T>
 void PlotStairs(const char* label_id, const T* xs, const T* ys, int count, ImPlotStairsFlags flags, int offset, int stride) {
+    SetItemCacheKey(flags, "PlotStairs", xs, ys, count, flags, offset, stride, sizeof(T));
     GetterXY<IndexerIdx<T>,IndexerIdx<T>> getter(IndexerIdx<T>(xs,count,offset,stride),IndexerIdx<T>(ys,count,offset,stride),count);
     return PlotStairsEx(label_id, getter, flags);
 }
 
+template <typename T>
+void PlotStairsRing(const char* label_id, const T* xs, const T* ys, int capacity, int head, int size, ImPlotStairsFlags flags, int stride) {
+    SetItemCacheKey(flags, "PlotStairsRing", xs, ys, capacity, head, size, flags, stride, sizeof(T));
+    IndexerRing<T> indexer_x(xs,capacity,head,size,stride);
+    IndexerRing<T> indexer_y(ys,capacity,head,size,stride);
+    GetterXY<IndexerRing<T>,IndexerRing<T>> getter(indexer_x,indexer_y,indexer_x.Count);
+    return PlotStairsEx(label_id, getter, flags);
+}
+
 #define INSTANTIATE_MACRO(T) \
     template IMPLOT_API void PlotStairs<T> (const char* label_id, const T* values, int count, double xscale, double x0, ImPlotStairsFlags flags, int offset, int stride); \
-    template IMPLOT_API void PlotStairs<T>(const char* label_id, const T* xs, const T* ys, int count, ImPlotStairsFlags flags, int offset, int stride);
+    template IMPLOT_API void PlotStairs<T>(const char* label_id, const T* xs, const T* ys, int count, ImPlotStairsFlags flags, int offset, int stride); \
+    template IMPLOT_API void PlotStairsRing<T>(const char* label_id, const T* xs, const T* ys, int capacity, int head, int size, ImPlotStairsFlags flags, int stride);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
 // custom
 void PlotStairsG(const char* label_id, ImPlotGetter getter_func, void* data, int count, ImPlotStairsFlags flags) {
+    SetItemCacheKey(flags, "PlotStairsG", getter_func, data, count, flags);
     GetterFuncPtr getter(getter_func,data, count);
     return PlotStairsEx(label_id, getter, flags);
 }
 
+void PlotStairsG(const char* label_id, ImPlotBatchGetter getter_func, void* data, int count, ImPlotStairsFlags flags) {
+    SetItemCacheKey(flags, "PlotStairsG", getter_func, data, count, flags);
+    GetterBatchPtr getter(getter_func,data, count);
+    return PlotStairsEx(label_id, getter, flags);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotShaded
 //-----------------------------------------------------------------------------
 
+// Reduces the region between two getters with the same ascending X to its low/high envelope per pixel column of the
+// current plot, written to #out as (x, low, high) triplets
+template <typename _Getter1, typename _Getter2>
+void DownsampleEnvelope(const _Getter1& getter1, const _Getter2& getter2, ImVector<double>& out) {
+    ImPlotPlot& plot = *GImPlot->CurrentPlot;
+    const Transformer1 tx = Transformer2(plot).Tx;
+    const float pix_min = plot.PlotRect.Min.x - 1;
+    const float pix_max = plot.PlotRect.Max.x + 1;
+    const int count = ImMin(getter1.Count, getter2.Count);
+    out.resize(0);
+    out.reserve(ImMin(count, 2 * ((int)(pix_max - pix_min) + 1)) * 3);
+    int    col = 0;
+    bool   open = false;
+    double x_first = 0, x_last = 0, lo = 0, hi = 0;
+    ImPlotPoint block1[GETTER_BATCH_SIZE];
+    ImPlotPoint block2[GETTER_BATCH_SIZE];
+    for (int b = 0; b < count; b += GETTER_BATCH_SIZE) {
+        const int n = ImMin(GETTER_BATCH_SIZE, count - b);
+        GetPoints(getter1, b, n, block1);
+        GetPoints(getter2, b, n, block2);
+        for (int i = 0; i < n; ++i) {
+            const ImPlotPoint& p1 = block1[i];
+            const ImPlotPoint& p2 = block2[i];
+            const float px = tx(p1.x);
+            const bool gap = ImNan(px) || ImNan(p1.y) || ImNan(p2.y);
+            const int c = gap ? col : (int)ImFloor(ImClamp(px, pix_min, pix_max));
+            if (open && !gap && c == col) {
+                x_last = p1.x;
+                lo = ImMin(lo, ImMin(p1.y, p2.y));
+                hi = ImMax(hi, ImMax(p1.y, p2.y));
+                continue;
+            }
+            if (open) {
+                out.push_back(x_first); out.push_back(lo); out.push_back(hi);
+                if (x_last != x_first) {
+                    out.push_back(x_last); out.push_back(lo); out.push_back(hi);
+                }
+            }
+            if (gap) {
+                // keep gaps intact so that missing data renders the same way it would without downsampling
+                out.push_back(p1.x); out.push_back(p1.y); out.push_back(p2.y);
+                open = false;
+                continue;
+            }
+            col     = c;
+            open    = true;
+            x_first = x_last = p1.x;
+            lo      = ImMin(p1.y, p2.y);
+            hi      = ImMax(p1.y, p2.y);
+        }
+    }
+    if (open) {
+        out.push_back(x_first); out.push_back(lo); out.push_back(hi);
+        if (x_last != x_first) {
+            out.push_back(x_last); out.push_back(lo); out.push_back(hi);
+        }
+    }
+}
+
 template <typename Getter1, typename Getter2>
 void PlotShadedEx(const char* label_id, const Getter1& getter1, const Getter2& getter2, ImPlotShadedFlags flags) {
-    if (BeginItemEx(label_id, Fitter2<Getter1,Getter2>(getter1,getter2), flags, ImPlotCol_Fill)) {
+    if (BeginItemEx(label_id, Fitter2<Getter1,Getter2>(getter1,getter2,flags), flags, ImPlotCol_Fill)) {
         if (getter1.Count <= 0 || getter2.Count <= 0) {
             EndItem();
             return;
         }
         const ImPlotNextItemData& s = GetItemData();
         if (s.RenderFill) {
+            // both getters are sliced with the range found for the first, which requires them to share their X values
+            const bool shared_x = getter1.Count == getter2.Count;
+            const GetterSlice<Getter1> visible1 = SliceVisibleX(getter1, ImHasFlag(flags, ImPlotItemFlags_SortedX) && shared_x);
+            const GetterSlice<Getter2> visible2(getter2, visible1.Start, visible1.Count);
             const ImU32 col = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
-            RenderPrimitives2<RendererShaded>(getter1,getter2,col);
+            if (ImHasFlag(flags, ImPlotShadedFlags_Downsample) && shared_x) {
+                ImVector<double>& envelope = GImPlot->TempDouble2;
+                DownsampleEnvelope(visible1, visible2, envelope);
+                const int n = envelope.Size / 3;
+                if (n > 0) {
+                    const int stride = 3 * sizeof(double);
+                    GetterXY<IndexerIdx<double>,IndexerIdx<double>> lower(IndexerIdx<double>(&envelope.Data[0],n,0,stride),IndexerIdx<double>(&envelope.Data[1],n,0,stride),n);
+                    GetterXY<IndexerIdx<double>,IndexerIdx<double>> upper(IndexerIdx<double>(&envelope.Data[0],n,0,stride),IndexerIdx<double>(&envelope.Data[2],n,0,stride),n);
+                    RenderPrimitives2<RendererShaded>(lower,upper,col);
+                }
+            }
+            else {
+                RenderPrimitives2<RendererShaded>(visible1,visible2,col);
+            }
         }
         EndItem();
     }
@@ -1773,6 +3966,7 @@ void PlotShadedEx(const char* label_id, const Getter1& getter1, const Getter2& g
 
 template <typename T>
 void PlotShaded(const char* label_id, const T* values, int count, double y_ref, double xscale, double x0, ImPlotShadedFlags flags, int offset, int stride) {
+    SetItemCacheKey(flags, "PlotShaded", values, count, y_ref, xscale, x0, flags, offset, stride, sizeof(T));
     if (!(y_ref > -DBL_MAX))
         y_ref = GetPlotLimits(IMPLOT_AUTO,IMPLOT_AUTO).Y.Min;
     if (!(y_ref < DBL_MAX))
@@ -1784,6 +3978,7 @@ void PlotShaded(const char* label_id, const T* values, int count, double y_ref,
 
 template <typename T>
 void PlotShaded(const char* label_id, const T* xs, const T* ys, int count, double y_ref, ImPlotShadedFlags flags, int offset, int stride) {
+    SetItemCacheKey(flags, "PlotShaded", xs, ys, count, y_ref, flags, offset, stride, sizeof(T));
     if (y_ref == -HUGE_VAL)
         y_ref = GetPlotLimits(IMPLOT_AUTO,IMPLOT_AUTO).Y.Min;
     if (y_ref == HUGE_VAL)
@@ -1796,93 +3991,213 @@ void PlotShaded(const char* label_id, const T* xs, const T* ys, int count, doubl
 
 template <typename T>
 void PlotShaded(const char* label_id, const T* xs, const T* ys1, const T* ys2, int count, ImPlotShadedFlags flags, int offset, int stride) {
+    SetItemCacheKey(flags, "PlotShaded", xs, ys1, ys2, count, flags, offset, stride, sizeof(T));
     GetterXY<IndexerIdx<T>,IndexerIdx<T>> getter1(IndexerIdx<T>(xs,count,offset,stride),IndexerIdx<T>(ys1,count,offset,stride),count);
     GetterXY<IndexerIdx<T>,IndexerIdx<T>> getter2(IndexerIdx<T>(xs,count,offset,stride),IndexerIdx<T>(ys2,count,offset,stride),count);
     PlotShadedEx(label_id, getter1, getter2, flags);
 }
 
+template <typename T>
+void PlotShadedRing(const char* label_id, const T* xs, const T* ys, int capacity, int head, int size, double y_ref, ImPlotShadedFlags flags, int stride) {
+    SetItemCacheKey(flags, "PlotShadedRing", xs, ys, capacity, head, size, y_ref, flags, stride, sizeof(T));
+    if (y_ref == -HUGE_VAL)
+        y_ref = GetPlotLimits(IMPLOT_AUTO,IMPLOT_AUTO).Y.Min;
+    if (y_ref == HUGE_VAL)
+        y_ref = GetPlotLimits(IMPLOT_AUTO,IMPLOT_AUTO).Y.Max;
+    IndexerRing<T> indexer_x(xs,capacity,head,size,stride);
+    IndexerRing<T> indexer_y(ys,capacity,head,size,stride);
+    GetterXY<IndexerRing<T>,IndexerRing<T>> getter1(indexer_x,indexer_y,indexer_x.Count);
+    GetterXY<IndexerRing<T>,IndexerConst>   getter2(indexer_x,IndexerConst(y_ref),indexer_x.Count);
+    PlotShadedEx(label_id, getter1, getter2, flags);
+}
+
+template <typename T>
+void PlotShadedRing(const char* label_id, const T* xs, const T* ys1, const T* ys2, int capacity, int head, int size, ImPlotShadedFlags flags, int stride) {
+    SetItemCacheKey(flags, "PlotShadedRing", xs, ys1, ys2, capacity, head, size, flags, stride, sizeof(T));
+    IndexerRing<T> indexer_x(xs,capacity,head,size,stride);
+    GetterXY<IndexerRing<T>,IndexerRing<T>> getter1(indexer_x,IndexerRing<T>(ys1,capacity,head,size,stride),indexer_x.Count);
+    GetterXY<IndexerRing<T>,IndexerRing<T>> getter2(indexer_x,IndexerRing<T>(ys2,capacity,head,size,stride),indexer_x.Count);
+    PlotShadedEx(label_id, getter1, getter2, flags);
+}
+
 #define INSTANTIATE_MACRO(T) \
     template IMPLOT_API void PlotShaded<T>(const char* label_id, const T* values, int count, double y_ref, double xscale, double x0, ImPlotShadedFlags flags, int offset, int stride); \
     template IMPLOT_API void PlotShaded<T>(const char* label_id, const T* xs, const T* ys, int count, double y_ref, ImPlotShadedFlags flags, int offset, int stride); \
-    template IMPLOT_API void PlotShaded<T>(const char* label_id, const T* xs, const T* ys1, const T* ys2, int count, ImPlotShadedFlags flags, int offset, int stride);
+    template IMPLOT_API void PlotShaded<T>(const char* label_id, const T* xs, const T* ys1, const T* ys2, int count, ImPlotShadedFlags flags, int offset, int stride); \
+    template IMPLOT_API void PlotShadedRing<T>(const char* label_id, const T* xs, const T* ys, int capacity, int head, int size, double y_ref, ImPlotShadedFlags flags, int stride); \
+    template IMPLOT_API void PlotShadedRing<T>(const char* label_id, const T* xs, const T* ys1, const T* ys2, int capacity, int head, int size, ImPlotShadedFlags flags, int stride);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
 // custom
 void PlotShadedG(const char* label_id, ImPlotGetter getter_func1, void* data1, ImPlotGetter getter_func2, void* data2, int count, ImPlotShadedFlags flags) {
+    SetItemCacheKey(flags, "PlotShadedG", getter_func1, data1, getter_func2, data2, count, flags);
     GetterFuncPtr getter1(getter_func1, data1, count);
     GetterFuncPtr getter2(getter_func2, data2, count);
     PlotShadedEx(label_id, getter1, getter2, flags);
 }
 
+void PlotShadedG(const char* label_id, ImPlotBatchGetter getter_func1, void* data1, ImPlotBatchGetter getter_func2, void* data2, int count, ImPlotShadedFlags flags) {
+    SetItemCacheKey(flags, "PlotShadedG", getter_func1, data1, getter_func2, data2, count, flags);
+    GetterBatchPtr getter1(getter_func1, data1, count);
+    GetterBatchPtr getter2(getter_func2, data2, count);
+    PlotShadedEx(label_id, getter1, getter2, flags);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] PlotBars
 //-----------------------------------------------------------------------------
 
+// Renders the fills and outlines of the current item's bars, spanning from getter1 to getter2.
 template <typename Getter1, typename Getter2>
-void PlotBarsVEx(const char* label_id, const Getter1& getter1, const Getter2 getter2, double width, ImPlotBarsFlags flags) {
+void RenderBarsEx(const Getter1& getter1, const Getter2& getter2, double size, bool horz) {
+    const ImPlotNextItemData& s = GetItemData();
+    const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
+    const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
+    bool rend_fill = s.RenderFill;
+    bool rend_line = s.RenderLine;
+    if (rend_fill) {
+        if (horz)
+            RenderPrimitives2<RendererBarsFillH>(getter1,getter2,col_fill,size);
+        else
+            RenderPrimitives2<RendererBarsFillV>(getter1,getter2,col_fill,size);
+        if (rend_line && col_fill == col_line)
+            rend_line = false;
+    }
+    if (rend_line) {
+        if (horz)
+            RenderPrimitives2<RendererBarsLineH>(getter1,getter2,col_line,size,s.LineWeight);
+        else
+            RenderPrimitives2<RendererBarsLineV>(getter1,getter2,col_line,size,s.LineWeight);
+    }
+}
+
+// Renders the current item's bars. If evenly_spaced is true, the bars' positions (X, or Y if horz is true) must
+// increase by the same step from one bar to the next, as for PlotBars without explicit positions and PlotBarGroups.
+// Bars outside of the axis range are then culled without being transformed, and if the bars are narrower than a pixel,
+// consecutive bars whose centers fall into the same pixel column and whose value ranges overlap or touch are merged into a
+// single bar covering all of their values (disjoint ranges, e.g. of stacked bar groups, would paint over the bars between them).
+template <typename Getter1, typename Getter2>
+void RenderBars(const Getter1& getter1, const Getter2& getter2, double size, bool horz, bool evenly_spaced) {
+    const int count = ImMin(getter1.Count, getter2.Count);
+    if (!evenly_spaced || count < 2) {
+        RenderBarsEx(getter1, getter2, size, horz);
+        return;
+    }
+    ImPlotContext& gp = *GImPlot;
+    const ImPlotPlot& plot = *gp.CurrentPlot;
+    const ImPlotAxis& axis = plot.Axes[horz ? plot.CurrentY : plot.CurrentX];
+    const double pos0 = horz ? getter1(0).y : getter1(0).x;
+    const double step = ((horz ? getter1(count-1).y : getter1(count-1).x) - pos0) / (count - 1);
+    if (ImNanOrInf(pos0) || ImNanOrInf(step) || step <= 0) {
+        RenderBarsEx(getter1, getter2, size, horz);
+        return;
+    }
+    // cull bars outside of the axis range, keeping one more on each side for bars widened to a pixel
+    const double half_size = ImAbs(size) * 0.5;
+    const double lo = (axis.Range.Min - half_size - pos0) / step - 1;
+    const double hi = (axis.Range.Max + half_size - pos0) / step + 1;
+    const int first = lo <= 0 ? 0 : lo >= count ? count : (int)lo;
+    const int last  = hi < 0 ? -1 : hi >= count - 1 ? count - 1 : (int)hi;
+    if (first > last)
+        return;
+    const double px_per_unit = ImAbs(axis.ScaleToPixel);
+    if (axis.TransformForward != nullptr || step * px_per_unit >= 1 || ImAbs(size) * px_per_unit >= 1) {
+        RenderBarsEx(GetterSlice<Getter1>(getter1, first, last - first + 1), GetterSlice<Getter2>(getter2, first, last - first + 1), size, horz);
+        return;
+    }
+    // merge the bars of each pixel column into one bar, stored as (position, min, max) triplets
+    ImVector<double>& merged = gp.TempDouble2;
+    merged.shrink(0);
+    int column = 0;
+    double pos_first = 0, pos_last = 0, v_min = 0, v_max = 0;
+    bool open = false;
+    for (int i = first; i <= last + 1; ++i) {
+        double pos = 0, v1 = 0, v2 = 0;
+        int c = column;
+        if (i <= last) {
+            const ImPlotPoint p1 = getter1(i);
+            const ImPlotPoint p2 = getter2(i);
+            pos = horz ? p1.y : p1.x;
+            v1  = horz ? p1.x : p1.y;
+            v2  = horz ? p2.x : p2.y;
+            if (ImNanOrInf(v1) || ImNanOrInf(v2))
+                continue;
+            c = (int)ImFloor(axis.PlotToPixels(pos));
+            if (open && c == column && ImMin(v1, v2) <= v_max && ImMax(v1, v2) >= v_min) {
+                pos_last = pos;
+                v_min    = ImMin(v_min, ImMin(v1, v2));
+                v_max    = ImMax(v_max, ImMax(v1, v2));
+                continue;
+            }
+        }
+        if (open) {
+            merged.push_back((pos_first + pos_last) * 0.5);
+            merged.push_back(v_min);
+            merged.push_back(v_max);
+        }
+        open      = true;
+        column    = c;
+        pos_first = pos_last = pos;
+        v_min     = ImMin(v1, v2);
+        v_max     = ImMax(v1, v2);
+    }
+    const int n = merged.Size / 3;
+    if (n == 0)
+        return;
+    const int stride = 3 * sizeof(double);
+    const IndexerIdx<double> pos_idx(&merged.Data[0], n, 0, stride);
+    const IndexerIdx<double> min_idx(&merged.Data[1], n, 0, stride);
+    const IndexerIdx<double> max_idx(&merged.Data[2], n, 0, stride);
+    typedef GetterXY<IndexerIdx<double>,IndexerIdx<double>> GetterMerged;
+    if (horz)
+        RenderBarsEx(GetterMerged(min_idx, pos_idx, n), GetterMerged(max_idx, pos_idx, n), size, horz);
+    else
+        RenderBarsEx(GetterMerged(pos_idx, min_idx, n), GetterMerged(pos_idx, max_idx, n), size, horz);
+}
+
+template <typename Getter1, typename Getter2>
+void PlotBarsVEx(const char* label_id, const Getter1& getter1, const Getter2 getter2, double width, ImPlotBarsFlags flags, bool evenly_spaced = false) {
     if (BeginItemEx(label_id, FitterBarV<Getter1,Getter2>(getter1,getter2,width), flags, ImPlotCol_Fill)) {
         if (getter1.Count <= 0 || getter2.Count <= 0) {
             EndItem();
             return;
         }
-        const ImPlotNextItemData& s = GetItemData();
-        const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
-        const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
-        bool rend_fill = s.RenderFill;
-        bool rend_line = s.RenderLine;
-        if (rend_fill) {
-            RenderPrimitives2<RendererBarsFillV>(getter1,getter2,col_fill,width);
-            if (rend_line && col_fill == col_line)
-                rend_line = false;
-        }
-        if (rend_line) {
-            RenderPrimitives2<RendererBarsLineV>(getter1,getter2,col_line,width,s.LineWeight);
-        }
+        RenderBars(getter1, getter2, width, false, evenly_spaced);
         EndItem();
     }
 }
 
 template <typename Getter1, typename Getter2>
-void PlotBarsHEx(const char* label_id, const Getter1& getter1, const Getter2& getter2, double height, ImPlotBarsFlags flags) {
+void PlotBarsHEx(const char* label_id, const Getter1& getter1, const Getter2& getter2, double height, ImPlotBarsFlags flags, bool evenly_spaced = false) {
     if (BeginItemEx(label_id, FitterBarH<Getter1,Getter2>(getter1,getter2,height), flags, ImPlotCol_Fill)) {
         if (getter1.Count <= 0 || getter2.Count <= 0) {
             EndItem();
-            return;
-        }
-        const ImPlotNextItemData& s = GetItemData();
-        const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
-        const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
-        bool rend_fill = s.RenderFill;
-        bool rend_line = s.RenderLine;
-        if (rend_fill) {
-            RenderPrimitives2<RendererBarsFillH>(getter1,getter2,col_fill,height);
-            if (rend_line && col_fill == col_line)
-                rend_line = false;
-        }
-        if (rend_line) {
-            RenderPrimitives2<RendererBarsLineH>(getter1,getter2,col_line,height,s.LineWeight);
+            return;
         }
+        RenderBars(getter1, getter2, height, true, evenly_spaced);
         EndItem();
     }
 }
 
 template <typename T>
 void PlotBars(const char* label_id, const T* values, int count, double bar_size, double shift, ImPlotBarsFlags flags, int offset, int stride) {
+    SetItemCacheKey(flags, "PlotBars", values, count, bar_size, shift, flags, offset, stride, sizeof(T));
     if (ImHasFlag(flags, ImPlotBarsFlags_Horizontal)) {
         GetterXY<IndexerIdx<T>,IndexerLin> getter1(IndexerIdx<T>(values,count,offset,stride),IndexerLin(1.0,shift),count);
         GetterXY<IndexerConst,IndexerLin>  getter2(IndexerConst(0),IndexerLin(1.0,shift),count);
-        PlotBarsHEx(label_id, getter1, getter2, bar_size, flags);
+        PlotBarsHEx(label_id, getter1, getter2, bar_size, flags, true);
     }
     else {
         GetterXY<IndexerLin,IndexerIdx<T>> getter1(IndexerLin(1.0,shift),IndexerIdx<T>(values,count,offset,stride),count);
         GetterXY<IndexerLin,IndexerConst>  getter2(IndexerLin(1.0,shift),IndexerConst(0),count);
-        PlotBarsVEx(label_id, getter1, getter2, bar_size, flags);
+        PlotBarsVEx(label_id, getter1, getter2, bar_size, flags, true);
     }
 }
 
 template <typename T>
 void PlotBars(const char* label_id, const T* xs, const T* ys, int count, double bar_size, ImPlotBarsFlags flags, int offset, int stride) {
+    SetItemCacheKey(flags, "PlotBars", xs, ys, count, bar_size, flags, offset, stride, sizeof(T));
     if (ImHasFlag(flags, ImPlotBarsFlags_Horizontal)) {
         GetterXY<IndexerIdx<T>,IndexerIdx<T>> getter1(IndexerIdx<T>(xs,count,offset,stride),IndexerIdx<T>(ys,count,offset,stride),count);
         GetterXY<IndexerConst, IndexerIdx<T>> getter2(IndexerConst(0),IndexerIdx<T>(ys,count,offset,stride),count);
@@ -1902,6 +4217,7 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
 void PlotBarsG(const char* label_id, ImPlotGetter getter_func, void* data, int count, double bar_size, ImPlotBarsFlags flags) {
+    SetItemCacheKey(flags, "PlotBarsG", getter_func, data, count, bar_size, flags);
     if (ImHasFlag(flags, ImPlotBarsFlags_Horizontal)) {
         GetterFuncPtr getter1(getter_func, data, count);
         GetterOverrideX<GetterFuncPtr> getter2(getter1,0);
@@ -1922,75 +4238,96 @@ template <typename T>
 void PlotBarGroups(const char* const label_ids[], const T* values, int item_count, int group_count, double group_size, double shift, ImPlotBarGroupsFlags flags) {
     const bool horz = ImHasFlag(flags, ImPlotBarGroupsFlags_Horizontal);
     const bool stack = ImHasFlag(flags, ImPlotBarGroupsFlags_Stacked);
-    if (stack) {
-        SetupLock();
-        ImPlotContext& gp = *GImPlot;
-        gp.TempDouble1.resize(4*group_count);
-        double* temp = gp.TempDouble1.Data;
-        double* neg =      &temp[0];
-        double* pos =      &temp[group_count];
-        double* curr_min = &temp[group_count*2];
-        double* curr_max = &temp[group_count*3];
-        for (int g = 0; g < group_count*2; ++g)
-            temp[g] = 0;
-        if (horz) {
-            for (int i = 0; i < item_count; ++i) {
-                if (!IsItemHidden(label_ids[i])) {
-                    for (int g = 0; g < group_count; ++g) {
-                        double v = (double)values[i*group_count+g];
-                        if (v > 0) {
-                            curr_min[g] = pos[g];
-                            curr_max[g] = curr_min[g] + v;
-                            pos[g]      += v;
-                        }
-                        else {
-                            curr_max[g] = neg[g];
-                            curr_min[g] = curr_max[g] + v;
-                            neg[g]      += v;
-                        }
-                    }
+    SetupLock();
+    ImPlotContext& gp = *GImPlot;
+    ImPlotPlot& plot = *gp.CurrentPlot;
+    // rather than fitting each item's bars, the extents of each group are gathered and fitted once after all items
+    const bool fit = plot.FitThisFrame;
+    gp.TempDouble1.resize(6*group_count);
+    double* temp = gp.TempDouble1.Data;
+    double* neg =      &temp[0];
+    double* pos =      &temp[group_count];
+    double* curr_min = &temp[group_count*2];
+    double* curr_max = &temp[group_count*3];
+    double* fit_min  = &temp[group_count*4];
+    double* fit_max  = &temp[group_count*5];
+    for (int g = 0; g < group_count*2; ++g)
+        temp[g] = 0;
+    for (int g = group_count*4; g < group_count*6; ++g)
+        temp[g] = 0;
+    const double subsize = stack ? group_size : group_size / item_count;
+    double fit_lo = HUGE_VAL, fit_hi = -HUGE_VAL;
+    for (int i = 0; i < item_count; ++i) {
+        if (!BeginItem(label_ids[i], 0, ImPlotCol_Fill))
+            continue;
+        const T* item_values = &values[i*group_count];
+        const double subshift = stack ? 0 : (i+0.5)*subsize - group_size/2;
+        if (stack) {
+            for (int g = 0; g < group_count; ++g) {
+                double v = (double)item_values[g];
+                if (v > 0) {
+                    curr_min[g] = pos[g];
+                    curr_max[g] = curr_min[g] + v;
+                    pos[g]      += v;
+                }
+                else {
+                    curr_max[g] = neg[g];
+                    curr_min[g] = curr_max[g] + v;
+                    neg[g]      += v;
                 }
+            }
+            if (fit) {
+                for (int g = 0; g < group_count; ++g) {
+                    fit_min[g] = curr_min[g] < fit_min[g] ? curr_min[g] : fit_min[g];
+                    fit_max[g] = curr_max[g] > fit_max[g] ? curr_max[g] : fit_max[g];
+                }
+            }
+            if (horz) {
                 GetterXY<IndexerIdx<double>,IndexerLin> getter1(IndexerIdx<double>(curr_min,group_count),IndexerLin(1.0,shift),group_count);
                 GetterXY<IndexerIdx<double>,IndexerLin> getter2(IndexerIdx<double>(curr_max,group_count),IndexerLin(1.0,shift),group_count);
-                PlotBarsHEx(label_ids[i],getter1,getter2,group_size,0);
+                RenderBars(getter1,getter2,group_size,true,true);
             }
-        }
-        else {
-            for (int i = 0; i < item_count; ++i) {
-                if (!IsItemHidden(label_ids[i])) {
-                    for (int g = 0; g < group_count; ++g) {
-                        double v = (double)values[i*group_count+g];
-                        if (v > 0) {
-                            curr_min[g] = pos[g];
-                            curr_max[g] = curr_min[g] + v;
-                            pos[g]      += v;
-                        }
-                        else {
-                            curr_max[g] = neg[g];
-                            curr_min[g] = curr_max[g] + v;
-                            neg[g]      += v;
-                        }
-                    }
-                }
+            else {
                 GetterXY<IndexerLin,IndexerIdx<double>> getter1(IndexerLin(1.0,shift),IndexerIdx<double>(curr_min,group_count),group_count);
                 GetterXY<IndexerLin,IndexerIdx<double>> getter2(IndexerLin(1.0,shift),IndexerIdx<double>(curr_max,group_count),group_count);
-                PlotBarsVEx(label_ids[i],getter1,getter2,group_size,0);
-            }
-        }
-    }
-    else {
-        const double subsize = group_size / item_count;
-        if (horz) {
-            for (int i = 0; i < item_count; ++i) {
-                const double subshift = (i+0.5)*subsize - group_size/2;
-                PlotBars(label_ids[i],&values[i*group_count],group_count,subsize,subshift+shift,ImPlotBarsFlags_Horizontal);
+                RenderBars(getter1,getter2,group_size,false,true);
             }
         }
         else {
-            for (int i = 0; i < item_count; ++i) {
-                const double subshift = (i+0.5)*subsize - group_size/2;
-                PlotBars(label_ids[i],&values[i*group_count],group_count,subsize,subshift+shift);
+            if (fit) {
+                for (int g = 0; g < group_count; ++g) {
+                    const double v = (double)item_values[g];
+                    fit_min[g] = v < fit_min[g] ? v : fit_min[g];
+                    fit_max[g] = v > fit_max[g] ? v : fit_max[g];
+                }
             }
+            if (horz) {
+                GetterXY<IndexerIdx<T>,IndexerLin> getter1(IndexerIdx<T>(item_values,group_count),IndexerLin(1.0,shift+subshift),group_count);
+                GetterXY<IndexerConst,IndexerLin>  getter2(IndexerConst(0),IndexerLin(1.0,shift+subshift),group_count);
+                RenderBars(getter1,getter2,subsize,true,true);
+            }
+            else {
+                GetterXY<IndexerLin,IndexerIdx<T>> getter1(IndexerLin(1.0,shift+subshift),IndexerIdx<T>(item_values,group_count),group_count);
+                GetterXY<IndexerLin,IndexerConst>  getter2(IndexerLin(1.0,shift+subshift),IndexerConst(0),group_count);
+                RenderBars(getter1,getter2,subsize,false,true);
+            }
+        }
+        fit_lo = ImMin(fit_lo, subshift - subsize/2);
+        fit_hi = ImMax(fit_hi, subshift + subsize/2);
+        EndItem();
+    }
+    if (fit && fit_lo <= fit_hi) {
+        ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+        ImPlotAxis& y_axis = plot.Axes[plot.CurrentY];
+        ImPlotAxis& p_axis = horz ? y_axis : x_axis;
+        ImPlotAxis& v_axis = horz ? x_axis : y_axis;
+        for (int g = 0; g < group_count; ++g) {
+            const double p1 = g + shift + fit_lo;
+            const double p2 = g + shift + fit_hi;
+            p_axis.ExtendFitWith(v_axis, p1, fit_min[g]);
+            v_axis.ExtendFitWith(p_axis, fit_min[g], p1);
+            p_axis.ExtendFitWith(v_axis, p2, fit_max[g]);
+            v_axis.ExtendFitWith(p_axis, fit_max[g], p2);
         }
     }
 }
@@ -2060,6 +4397,7 @@ void PlotErrorBars(const char* label_id, const T* xs, const T* ys, const T* err,
 
 template <typename T>
 void PlotErrorBars(const char* label_id, const T* xs, const T* ys, const T* neg, const T* pos, int count, ImPlotErrorBarsFlags flags, int offset, int stride) {
+    SetItemCacheKey(flags, "PlotErrorBars", xs, ys, neg, pos, count, flags, offset, stride, sizeof(T));
     IndexerIdx<T> indexer_x(xs, count,offset,stride);
     IndexerIdx<T> indexer_y(ys, count,offset,stride);
     IndexerIdx<T> indexer_n(neg,count,offset,stride);
@@ -2093,16 +4431,18 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 
 template <typename _GetterM, typename _GetterB>
 void PlotStemsEx(const char* label_id, const _GetterM& getter_mark, const _GetterB& getter_base, ImPlotStemsFlags flags) {
-    if (BeginItemEx(label_id, Fitter2<_GetterM,_GetterB>(getter_mark,getter_base), flags, ImPlotCol_Line)) {
+    if (BeginItemEx(label_id, Fitter2<_GetterM,_GetterB>(getter_mark,getter_base,flags), flags, ImPlotCol_Line)) {
         if (getter_mark.Count <= 0 || getter_base.Count <= 0) {
             EndItem();
             return;
         }
         const ImPlotNextItemData& s = GetItemData();
+        const GetterSlice<_GetterM> visible_mark = SliceVisibleX(getter_mark, ImHasFlag(flags, ImPlotItemFlags_SortedX) && getter_mark.Count == getter_base.Count);
+        const GetterSlice<_GetterB> visible_base(getter_base, visible_mark.Start, visible_mark.Count);
         // render stems
         if (s.RenderLine) {
             const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
-            RenderPrimitives2<RendererLineSegments2>(getter_mark, getter_base, col_line, s.LineWeight);
+            RenderPrimitives2<RendererLineSegments2>(visible_mark, visible_base, col_line, s.LineWeight);
         }
         // render markers
         if (s.Marker != ImPlotMarker_None) {
@@ -2110,7 +4450,7 @@ void PlotStemsEx(const char* label_id, const _GetterM& getter_mark, const _Gette
             PushPlotClipRect(s.MarkerSize);
             const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
             const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
-            RenderMarkers<_GetterM>(getter_mark, s.Marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+            RenderMarkers<GetterSlice<_GetterM>>(visible_mark, s.Marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
         }
         EndItem();
     }
@@ -2118,6 +4458,7 @@ void PlotStemsEx(const char* label_id, const _GetterM& getter_mark, const _Gette
 
 template <typename T>
 void PlotStems(const char* label_id, const T* values, int count, double ref, double scale, double start, ImPlotStemsFlags flags, int offset, int stride) {
+    SetItemCacheKey(flags, "PlotStems", values, count, ref, scale, start, flags, offset, stride, sizeof(T));
     if (ImHasFlag(flags, ImPlotStemsFlags_Horizontal)) {
         GetterXY<IndexerIdx<T>,IndexerLin> get_mark(IndexerIdx<T>(values,count,offset,stride),IndexerLin(scale,start),count);
         GetterXY<IndexerConst,IndexerLin>  get_base(IndexerConst(ref),IndexerLin(scale,start),count);
@@ -2132,6 +4473,7 @@ void PlotStems(const char* label_id, const T* values, int count, double ref, dou
 
 template <typename T>
 void PlotStems(const char* label_id, const T* xs, const T* ys, int count, double ref, ImPlotStemsFlags flags, int offset, int stride) {
+    SetItemCacheKey(flags, "PlotStems", xs, ys, count, ref, flags, offset, stride, sizeof(T));
     if (ImHasFlag(flags, ImPlotStemsFlags_Horizontal)) {
         GetterXY<IndexerIdx<T>,IndexerIdx<T>> get_mark(IndexerIdx<T>(xs,count,offset,stride),IndexerIdx<T>(ys,count,offset,stride),count);
         GetterXY<IndexerConst,IndexerIdx<T>>  get_base(IndexerConst(ref),IndexerIdx<T>(ys,count,offset,stride),count);
@@ -2157,6 +4499,7 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 
 template <typename T>
 void PlotInfLines(const char* label_id, const T* values, int count, ImPlotInfLinesFlags flags, int offset, int stride) {
+    SetItemCacheKey(flags, "PlotInfLines", values, count, flags, offset, stride, sizeof(T));
     const ImPlotRect lims = GetPlotLimits(IMPLOT_AUTO,IMPLOT_AUTO);
     if (ImHasFlag(flags, ImPlotInfLinesFlags_Horizontal)) {
         GetterXY<IndexerConst,IndexerIdx<T>> getter_min(IndexerConst(lims.X.Min),IndexerIdx<T>(values,count,offset,stride),count);
@@ -2339,14 +4682,35 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 //-----------------------------------------------------------------------------
 
 template <typename T>
+void ColormapMapValues(const T* values, int count, double scale_min, double scale_max, ImU32* out, ImPlotColormap cmap) {
+    ImPlotContext& gp = *GImPlot;
+    cmap = cmap == IMPLOT_AUTO ? gp.Style.Colormap : cmap;
+    IM_ASSERT_USER_ERROR(cmap >= 0 && cmap < gp.ColormapData.Count, "Invalid colormap index!");
+    // same index as LerpTable: (int)((size-1)*t + 0.5f) for continuous and ImClamp((int)(size*t),0,size-1) for qualitative colormaps
+    const ImU32* table = gp.ColormapData.GetTable(cmap);
+    const int    size  = gp.ColormapData.GetTableSize(cmap);
+    const bool   qual  = gp.ColormapData.IsQual(cmap);
+    const float  mul   = (float)(qual ? size : size - 1);
+    const float  add   = qual ? 0.0f : 0.5f;
+    const float  lim   = (float)(size - 1);
+    int i = count >= SIMD_MIN_COUNT ? ImColormapSimd(values, count, scale_min, scale_max, table, mul, add, lim, out) : 0;
+    for (; i < count; ++i) {
+        float t = (float)ImRemap01((double)values[i], scale_min, scale_max);
+        t = t > 0 ? (t < 1 ? t : 1) : 0;
+        out[i] = table[(int)ImMin(t * mul + add, lim)];
+    }
+}
+
+#define INSTANTIATE_MACRO(T) template IMPLOT_API void ColormapMapValues<T>(const T* values, int count, double scale_min, double scale_max, ImU32* out, ImPlotColormap cmap);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
 struct GetterHeatmapRowMaj {
-    GetterHeatmapRowMaj(const T* values, int rows, int cols, double scale_min, double scale_max, double width, double height, double xref, double yref, double ydir) :
-        Values(values),
+    GetterHeatmapRowMaj(const ImU32* colors, int rows, int cols, double width, double height, double xref, double yref, double ydir) :
+        Colors(colors),
         Count(rows*cols),
         Rows(rows),
         Cols(cols),
-        ScaleMin(scale_min),
-        ScaleMax(scale_max),
         Width(width),
         Height(height),
         XRef(xref),
@@ -2355,33 +4719,27 @@ struct GetterHeatmapRowMaj {
         HalfSize(Width*0.5, Height*0.5)
     { }
     template <typename I> IMPLOT_INLINE RectC operator()(I idx) const {
-        double val = (double)Values[idx];
         const int r = idx / Cols;
         const int c = idx % Cols;
         const ImPlotPoint p(XRef + HalfSize.x + c*Width, YRef + YDir * (HalfSize.y + r*Height));
         RectC rect;
         rect.Pos = p;
         rect.HalfSize = HalfSize;
-        const float t = ImClamp((float)ImRemap01(val, ScaleMin, ScaleMax),0.0f,1.0f);
-        ImPlotContext& gp = *GImPlot;
-        rect.Color = gp.ColormapData.LerpTable(gp.Style.Colormap, t);
+        rect.Color = Colors[idx];
         return rect;
     }
-    const T* const Values;
+    const ImU32* const Colors;
     const int Count, Rows, Cols;
-    const double ScaleMin, ScaleMax, Width, Height, XRef, YRef, YDir;
+    const double Width, Height, XRef, YRef, YDir;
     const ImPlotPoint HalfSize;
 };
 
-template <typename T>
 struct GetterHeatmapColMaj {
-    GetterHeatmapColMaj(const T* values, int rows, int cols, double scale_min, double scale_max, double width, double height, double xref, double yref, double ydir) :
-        Values(values),
+    GetterHeatmapColMaj(const ImU32* colors, int rows, int cols, double width, double height, double xref, double yref, double ydir) :
+        Colors(colors),
         Count(rows*cols),
         Rows(rows),
         Cols(cols),
-        ScaleMin(scale_min),
-        ScaleMax(scale_max),
         Width(width),
         Height(height),
         XRef(xref),
@@ -2390,33 +4748,164 @@ struct GetterHeatmapColMaj {
         HalfSize(Width*0.5, Height*0.5)
     { }
     template <typename I> IMPLOT_INLINE RectC operator()(I idx) const {
-        double val = (double)Values[idx];
         const int r = idx % Rows;
         const int c = idx / Rows;
         const ImPlotPoint p(XRef + HalfSize.x + c*Width, YRef + YDir * (HalfSize.y + r*Height));
         RectC rect;
         rect.Pos = p;
         rect.HalfSize = HalfSize;
-        const float t = ImClamp((float)ImRemap01(val, ScaleMin, ScaleMax),0.0f,1.0f);
-        ImPlotContext& gp = *GImPlot;
-        rect.Color = gp.ColormapData.LerpTable(gp.Style.Colormap, t);
+        rect.Color = Colors[idx];
         return rect;
     }
-    const T* const Values;
+    const ImU32* const Colors;
     const int Count, Rows, Cols;
-    const double ScaleMin, ScaleMax, Width, Height, XRef, YRef, YDir;
+    const double Width, Height, XRef, YRef, YDir;
     const ImPlotPoint HalfSize;
 };
 
+static const int HEATMAP_LABEL_CACHE_SIZE = 16384;
+
+// Formats a heatmap label, reusing the string of a previous call with the same value and format. The returned
+// string is either #buff or cached, and valid until the next call.
+template <typename T>
+const char* FormatHeatmapLabel(char (&buff)[32], const char* fmt, ImGuiID fmt_id, T value) {
+    ImPlotContext& gp = *GImPlot;
+    ImU64 bits = 0;
+    memcpy(&bits, &value, sizeof(T));
+    const ImGuiID key = ImHashData(&bits, sizeof(bits), fmt_id);
+    int idx = gp.HeatmapLabelMap.GetInt(key, -1);
+    if (idx >= 0 && gp.HeatmapLabels[idx].Value == bits && gp.HeatmapLabels[idx].FmtId == fmt_id)
+        return gp.HeatmapLabelText.Data + gp.HeatmapLabels[idx].TextOffset;
+    ImFormatString(buff, 32, fmt, value);
+    // hash collisions are formatted every time
+    if (idx >= 0)
+        return buff;
+    if (gp.HeatmapLabels.Size >= HEATMAP_LABEL_CACHE_SIZE) {
+        gp.HeatmapLabelMap.Clear();
+        gp.HeatmapLabels.resize(0);
+        gp.HeatmapLabelText.resize(0);
+    }
+    ImPlotHeatmapLabel label;
+    label.Value      = bits;
+    label.FmtId      = fmt_id;
+    label.TextOffset = gp.HeatmapLabelText.Size;
+    gp.HeatmapLabelMap.SetInt(key, gp.HeatmapLabels.Size);
+    gp.HeatmapLabels.push_back(label);
+    const int len = (int)strlen(buff) + 1;
+    gp.HeatmapLabelText.resize(label.TextOffset + len);
+    memcpy(gp.HeatmapLabelText.Data + label.TextOffset, buff, len);
+    return gp.HeatmapLabelText.Data + label.TextOffset;
+}
+
+// Renders the labels of the heatmap cells which are visible and large enough to fit them
+template <typename T>
+void RenderHeatmapLabels(ImDrawList& draw_list, const Transformer2& transformer, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, double yref, double ydir, bool col_maj) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotPlot& plot = *gp.CurrentPlot;
+    const ImPlotRange& x_range = plot.Axes[plot.CurrentX].Range;
+    const ImPlotRange& y_range = plot.Axes[plot.CurrentY].Range;
+    const double w = (bounds_max.x - bounds_min.x) / cols;
+    const double h = (bounds_max.y - bounds_min.y) / rows;
+    // visible range of cells
+    const double c_a = (x_range.Min - bounds_min.x) / w, c_b = (x_range.Max - bounds_min.x) / w;
+    const double r_a = (y_range.Min - yref) / (ydir * h), r_b = (y_range.Max - yref) / (ydir * h);
+    const int c0 = (int)ImClamp(floor(ImMin(c_a, c_b)), 0.0, (double)cols);
+    const int c1 = (int)ImClamp(ceil(ImMax(c_a, c_b)),  0.0, (double)cols);
+    const int r0 = (int)ImClamp(floor(ImMin(r_a, r_b)), 0.0, (double)rows);
+    const int r1 = (int)ImClamp(ceil(ImMax(r_a, r_b)),  0.0, (double)rows);
+    const float font_size = ImGui::GetFontSize();
+    // the same bits format differently depending on the value's type
+    const ImGuiID fmt_id = ImHashStr(fmt, 0, (ImGuiID)sizeof(T) * 4 + ((T)0.5 != (T)0 ? 1 : 0) + ((T)-1 < (T)0 ? 2 : 0));
+    for (int r = r0; r < r1; ++r) {
+        const float cell_h = ImAbs(transformer.Ty(yref + ydir * (r + 1) * h) - transformer.Ty(yref + ydir * r * h));
+        if (cell_h < font_size)
+            continue;
+        for (int c = c0; c < c1; ++c) {
+            const float cell_w = ImAbs(transformer.Tx(bounds_min.x + (c + 1) * w) - transformer.Tx(bounds_min.x + c * w));
+            const int i = col_maj ? c * rows + r : r * cols + c;
+            char buff[32];
+            const char* label = FormatHeatmapLabel(buff, fmt, fmt_id, values[i]);
+            const ImVec2 size = ImGui::CalcTextSize(label);
+            if (cell_w < size.x)
+                continue;
+            const ImVec2 px = transformer(ImPlotPoint(bounds_min.x + 0.5*w + c*w, yref + ydir * (0.5*h + r*h)));
+            const double t = ImClamp(ImRemap01((double)values[i], scale_min, scale_max),0.0,1.0);
+            const ImU32 col = CalcTextColor(SampleColormap((float)t));
+            draw_list.AddText(px - size * 0.5f, col, label);
+        }
+    }
+}
+
+static const int HEATMAP_TEXTURE_MAX_IDLE_FRAMES = 60;
+
+// Renders a heatmap as a single image of its colored values (see ImPlotHeatmapFlags_Texture), uploading them only when
+// they may have changed. Returns false if the heatmap can't be rendered this way.
 template <typename T>
-void RenderHeatmap(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, bool reverse_y, bool col_maj) {
+bool RenderHeatmapTexture(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, bool reverse_y, bool col_maj) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotPlot& plot = *gp.CurrentPlot;
+    if (gp.TextureUpdate == nullptr || gp.CurrentItem == nullptr || plot.Axes[plot.CurrentX].TransformForward != nullptr || plot.Axes[plot.CurrentY].TransformForward != nullptr)
+        return false;
+    // discard textures of items which are no longer plotted, once per frame
+    const int frame = ImGui::GetFrameCount();
+    if (gp.HeatmapTexturesFrame != frame) {
+        gp.HeatmapTexturesFrame = frame;
+        for (int i = 0; i < gp.HeatmapTextures.GetMapSize(); ++i) {
+            ImPlotHeatmapTexture* tex = gp.HeatmapTextures.TryGetMapData(i);
+            if (tex != nullptr && frame - tex->LastFrame > HEATMAP_TEXTURE_MAX_IDLE_FRAMES) {
+                if (tex->Texture != 0 && gp.TextureDestroy != nullptr)
+                    gp.TextureDestroy(tex->Texture, gp.TextureUserData);
+                gp.HeatmapTextures.Remove(gp.HeatmapTextures.Map.Data[i].key, tex);
+            }
+        }
+    }
+    const ImPlotColormap cmap = gp.Style.Colormap;
+    const double scale[2] = { scale_min, scale_max };
+    const int layout[5] = { rows, cols, (int)sizeof(T), (int)reverse_y, (int)col_maj };
+    ImGuiID key = ImHashData(&values, sizeof(values));
+    key = ImHashData(scale, sizeof(scale), key);
+    key = ImHashData(layout, sizeof(layout), key);
+    key = ImHashData(&cmap, sizeof(cmap), key);
+    key = ImHashData(gp.ColormapData.GetTable(cmap), gp.ColormapData.GetTableSize(cmap) * sizeof(ImU32), key);
+    key = key != 0 ? key : 1;
+    ImPlotHeatmapTexture& tex = *gp.HeatmapTextures.GetOrAddByKey(ImHashData(&plot.ID, sizeof(ImGuiID), gp.CurrentItem->ID));
+    tex.LastFrame = frame;
+    if (tex.Texture == 0 || tex.Key != key) {
+        ImVector<ImU32>& colors = gp.HeatmapColors;
+        ImVector<ImU32>& pixels = gp.HeatmapPixels;
+        colors.resize(rows * cols);
+        pixels.resize(rows * cols);
+        ColormapMapValues(values, rows * cols, scale_min, scale_max, colors.Data, cmap);
+        for (int r = 0; r < rows; ++r) {
+            // the first texture row is at bounds_max.y
+            ImU32* row = pixels.Data + (reverse_y ? r : rows - 1 - r) * cols;
+            if (col_maj) {
+                for (int c = 0; c < cols; ++c)
+                    row[c] = colors[c * rows + r];
+            }
+            else {
+                memcpy(row, colors.Data + r * cols, cols * sizeof(ImU32));
+            }
+        }
+        tex.Texture = gp.TextureUpdate(tex.Texture, cols, rows, pixels.Data, gp.TextureUserData);
+        tex.Key     = tex.Texture != 0 ? key : 0;
+        tex.Data    = values;
+        if (tex.Texture == 0)
+            return false;
+    }
+    Transformer2 transformer;
+    draw_list.AddImage(tex.Texture, transformer(bounds_min.x, bounds_max.y), transformer(bounds_max.x, bounds_min.y));
+    return true;
+}
+
+template <typename T>
+void RenderHeatmap(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, bool reverse_y, bool col_maj, bool cache_extents = false, bool texture = false) {
     ImPlotContext& gp = *GImPlot;
     Transformer2 transformer;
     if (scale_min == 0 && scale_max == 0) {
-        T temp_min, temp_max;
-        ImMinMaxArray(values,rows*cols,&temp_min,&temp_max);
-        scale_min = (double)temp_min;
-        scale_max = (double)temp_max;
+        const ImPlotRange scale = CalcArrayExtents(values, rows*cols, cache_extents);
+        scale_min = scale.Min;
+        scale_max = scale.Max;
     }
     if (scale_min == scale_max) {
         ImVec2 a = transformer(bounds_min);
@@ -2427,69 +4916,35 @@ void RenderHeatmap(ImDrawList& draw_list, const T* values, int rows, int cols, d
     }
     const double yref = reverse_y ? bounds_max.y : bounds_min.y;
     const double ydir = reverse_y ? -1 : 1;
-    if (col_maj) {
-        GetterHeatmapColMaj<T> getter(values, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
-        RenderPrimitives1<RendererRectC>(getter);
-    }
-    else {
-        GetterHeatmapRowMaj<T> getter(values, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
-        RenderPrimitives1<RendererRectC>(getter);
-    }
-    // labels
-    if (fmt != nullptr) {
-        const double w = (bounds_max.x - bounds_min.x) / cols;
-        const double h = (bounds_max.y - bounds_min.y) / rows;
-        const ImPlotPoint half_size(w*0.5,h*0.5);
-        int i = 0;
+    if (!texture || !RenderHeatmapTexture(draw_list, values, rows, cols, scale_min, scale_max, bounds_min, bounds_max, reverse_y, col_maj)) {
+        ImVector<ImU32>& colors = gp.HeatmapColors;
+        colors.resize(rows * cols);
+        ColormapMapValues(values, rows * cols, scale_min, scale_max, colors.Data, gp.Style.Colormap);
         if (col_maj) {
-            for (int c = 0; c < cols; ++c) {
-                for (int r = 0; r < rows; ++r) {
-                    ImPlotPoint p;
-                    p.x = bounds_min.x + 0.5*w + c*w;
-                    p.y = yref + ydir * (0.5*h + r*h);
-                    ImVec2 px = transformer(p);
-                    char buff[32];
-                    ImFormatString(buff, 32, fmt, values[i]);
-                    ImVec2 size = ImGui::CalcTextSize(buff);
-                    double t = ImClamp(ImRemap01((double)values[i], scale_min, scale_max),0.0,1.0);
-                    ImVec4 color = SampleColormap((float)t);
-                    ImU32 col = CalcTextColor(color);
-                    draw_list.AddText(px - size * 0.5f, col, buff);
-                    i++;
-                }
-            }
+            GetterHeatmapColMaj getter(colors.Data, rows, cols, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
+            RenderPrimitives1<RendererRectC>(getter);
         }
         else {
-            for (int r = 0; r < rows; ++r) {
-                for (int c = 0; c < cols; ++c) {
-                    ImPlotPoint p;
-                    p.x = bounds_min.x + 0.5*w + c*w;
-                    p.y = yref + ydir * (0.5*h + r*h);
-                    ImVec2 px = transformer(p);
-                    char buff[32];
-                    ImFormatString(buff, 32, fmt, values[i]);
-                    ImVec2 size = ImGui::CalcTextSize(buff);
-                    double t = ImClamp(ImRemap01((double)values[i], scale_min, scale_max),0.0,1.0);
-                    ImVec4 color = SampleColormap((float)t);
-                    ImU32 col = CalcTextColor(color);
-                    draw_list.AddText(px - size * 0.5f, col, buff);
-                    i++;
-                }
-            }
+            GetterHeatmapRowMaj getter(colors.Data, rows, cols, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
+            RenderPrimitives1<RendererRectC>(getter);
         }
     }
+    // labels
+    if (fmt != nullptr)
+        RenderHeatmapLabels(draw_list, transformer, values, rows, cols, scale_min, scale_max, fmt, bounds_min, bounds_max, yref, ydir, col_maj);
 }
 
 template <typename T>
 void PlotHeatmap(const char* label_id, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, ImPlotHeatmapFlags flags) {
-    if (BeginItemEx(label_id, FitterRect(bounds_min, bounds_max))) {
+    SetItemCacheKey(flags, "PlotHeatmap", values, rows, cols, scale_min, scale_max, fmt, bounds_min, bounds_max, flags, sizeof(T));
+    if (BeginItemEx(label_id, FitterRect(bounds_min, bounds_max), flags)) {
         if (rows <= 0 || cols <= 0) {
             EndItem();
             return;
         }
         ImDrawList& draw_list = *GetPlotDrawList();
         const bool col_maj = ImHasFlag(flags, ImPlotHeatmapFlags_ColMajor);
-        RenderHeatmap(draw_list, values, rows, cols, scale_min, scale_max, fmt, bounds_min, bounds_max, true, col_maj);
+        RenderHeatmap(draw_list, values, rows, cols, scale_min, scale_max, fmt, bounds_min, bounds_max, true, col_maj, ImHasFlag(flags, ImPlotItemFlags_CacheExtents), ImHasFlag(flags, ImPlotHeatmapFlags_Texture));
         EndItem();
     }
 }
@@ -2501,55 +4956,111 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 // [SECTION] PlotHistogram
 //-----------------------------------------------------------------------------
 
-template <typename T>
-double PlotHistogram(const char* label_id, const T* values, int count, int bins, double bar_scale, ImPlotRange range, ImPlotHistogramFlags flags) {
-
-    const bool cumulative = ImHasFlag(flags, ImPlotHistogramFlags_Cumulative);
-    const bool density    = ImHasFlag(flags, ImPlotHistogramFlags_Density);
-    const bool outliers   = !ImHasFlag(flags, ImPlotHistogramFlags_NoOutliers);
-
-    if (count <= 0 || bins == 0)
-        return 0;
+// Number of values binned by each job of BinHistogram, and maximum number of jobs (each job has its own bins)
+static const int HISTOGRAM_JOB_VALUES = 262144;
+static const int HISTOGRAM_MAX_JOBS   = 8;
 
-    if (range.Min == 0 && range.Max == 0) {
-        T Min, Max;
-        ImMinMaxArray(values, count, &Min, &Max);
-        range.Min = (double)Min;
-        range.Max = (double)Max;
+template <typename T>
+struct HistogramJob {
+    const T*   Xs;
+    const T*   Ys;      // nullptr for 1D histograms
+    int        Count, Jobs;
+    ImPlotRect Range;
+    double     Width, Height;
+    int        XBins, YBins;
+    int*       Counts;  // Jobs arrays of XBins*YBins bins, followed by the binned and below range counts of each job
+
+    static void Run(int job, void* data) {
+        const HistogramJob& self = *(const HistogramJob*)data;
+        const int first = (int)((ImS64)self.Count * job / self.Jobs);
+        const int last  = (int)((ImS64)self.Count * (job + 1) / self.Jobs);
+        int* counts  = self.Counts + (size_t)job * self.XBins * self.YBins;
+        int* totals  = self.Counts + (size_t)self.Jobs * self.XBins * self.YBins + job * 2;
+        int counted  = 0;
+        int below    = 0;
+        if (self.Ys == nullptr) {
+            for (int i = first; i < last; ++i) {
+                const double val = (double)self.Xs[i];
+                if (self.Range.X.Contains(val)) {
+                    counts[ImClamp((int)((val - self.Range.X.Min) / self.Width), 0, self.XBins - 1)]++;
+                    counted++;
+                }
+                else if (val < self.Range.X.Min) {
+                    below++;
+                }
+            }
+        }
+        else {
+            for (int i = first; i < last; ++i) {
+                const double x = (double)self.Xs[i];
+                const double y = (double)self.Ys[i];
+                if (self.Range.Contains(x, y)) {
+                    const int xb = ImClamp((int)((x - self.Range.X.Min) / self.Width),  0, self.XBins - 1);
+                    const int yb = ImClamp((int)((y - self.Range.Y.Min) / self.Height), 0, self.YBins - 1);
+                    counts[yb * self.XBins + xb]++;
+                    counted++;
+                }
+            }
+        }
+        totals[0] = counted;
+        totals[1] = below;
     }
+};
 
-    double width;
-    if (bins < 0)
-        CalculateBins(values, count, bins, range, bins, width);
+// Counts the values of #xs (and #ys, if not nullptr) that fall into each bin of #range, in parallel if #parallel_for is not nullptr.
+// #scratch holds the bins of each job. Returns the number of binned values, and the number of values below the range in #below (1D only).
+// Does not access the current context, so it may be called from any thread.
+template <typename T>
+int BinHistogram(const T* xs, const T* ys, int count, const ImPlotRect& range, double width, double height, int x_bins, int y_bins, double* bin_counts, ImVector<int>& scratch, int* below, ImPlotParallelFor parallel_for, void* parallel_data) {
+    const int bins = x_bins * y_bins;
+    int jobs = 1;
+    if (parallel_for != nullptr)
+        jobs = ImClamp(ImMin(count / HISTOGRAM_JOB_VALUES, count / bins), 1, HISTOGRAM_MAX_JOBS);
+    scratch.resize(jobs * (bins + 2));
+    memset(scratch.Data, 0, scratch.size_in_bytes());
+    HistogramJob<T> job;
+    job.Xs     = xs;
+    job.Ys     = ys;
+    job.Count  = count;
+    job.Jobs   = jobs;
+    job.Range  = range;
+    job.Width  = width;
+    job.Height = height;
+    job.XBins  = x_bins;
+    job.YBins  = y_bins;
+    job.Counts = scratch.Data;
+    if (jobs > 1)
+        parallel_for(jobs, HistogramJob<T>::Run, &job, parallel_data);
     else
-        width = range.Size() / bins;
-
-    ImPlotContext& gp = *GImPlot;
-    ImVector<double>& bin_centers = gp.TempDouble1;
-    ImVector<double>& bin_counts  = gp.TempDouble2;
-    bin_centers.resize(bins);
-    bin_counts.resize(bins);
-    int below = 0;
-
+        HistogramJob<T>::Run(0, &job);
     for (int b = 0; b < bins; ++b) {
-        bin_centers[b] = range.Min + b * width + width * 0.5;
-        bin_counts[b] = 0;
+        int n = scratch.Data[b];
+        for (int j = 1; j < jobs; ++j)
+            n += scratch.Data[j * bins + b];
+        bin_counts[b] = (double)n;
     }
     int counted = 0;
-    double max_count = 0;
-    for (int i = 0; i < count; ++i) {
-        double val = (double)values[i];
-        if (range.Contains(val)) {
-            const int b = ImClamp((int)((val - range.Min) / width), 0, bins - 1);
-            bin_counts[b] += 1.0;
-            if (bin_counts[b] > max_count)
-                max_count = bin_counts[b];
-            counted++;
-        }
-        else if (val < range.Min) {
-            below++;
-        }
+    *below = 0;
+    for (int j = 0; j < jobs; ++j) {
+        counted += scratch.Data[jobs * bins + j * 2];
+        *below  += scratch.Data[jobs * bins + j * 2 + 1];
     }
+    return counted;
+}
+
+// Bins #values into #bin_counts and applies the cumulative and density flags. Returns the largest bin count or density.
+template <typename T>
+double CalcHistogram(const T* values, int count, double* bin_counts, int bins, const ImPlotRange& range, double width, ImPlotHistogramFlags flags, ImVector<int>& scratch, ImPlotParallelFor parallel_for, void* parallel_data) {
+
+    const bool cumulative = ImHasFlag(flags, ImPlotHistogramFlags_Cumulative);
+    const bool density    = ImHasFlag(flags, ImPlotHistogramFlags_Density);
+    const bool outliers   = !ImHasFlag(flags, ImPlotHistogramFlags_NoOutliers);
+
+    int below;
+    const int counted = BinHistogram(values, (const T*)nullptr, count, ImPlotRect(range.Min, range.Max, 0, 0), width, 0, bins, 1, bin_counts, scratch, &below, parallel_for, parallel_data);
+    double max_count = 0;
+    for (int b = 0; b < bins; ++b)
+        max_count = ImMax(max_count, bin_counts[b]);
     if (cumulative && density) {
         if (outliers)
             bin_counts[0] += below;
@@ -2573,6 +5084,72 @@ double PlotHistogram(const char* label_id, const T* values, int count, int bins,
             bin_counts[b] *= scale;
         max_count *= scale;
     }
+    return max_count;
+}
+
+// Bins #xs and #ys into #bin_counts (row major) and applies the density flag. Returns the largest bin count or density.
+template <typename T>
+double CalcHistogram2D(const T* xs, const T* ys, int count, double* bin_counts, int x_bins, int y_bins, const ImPlotRect& range, double width, double height, ImPlotHistogramFlags flags, ImVector<int>& scratch, ImPlotParallelFor parallel_for, void* parallel_data) {
+
+    // const bool cumulative = ImHasFlag(flags, ImPlotHistogramFlags_Cumulative); NOT SUPPORTED
+    const bool density  = ImHasFlag(flags, ImPlotHistogramFlags_Density);
+    const bool outliers = !ImHasFlag(flags, ImPlotHistogramFlags_NoOutliers);
+
+    int below;
+    const int counted = BinHistogram(xs, ys, count, range, width, height, x_bins, y_bins, bin_counts, scratch, &below, parallel_for, parallel_data);
+    double max_count = 0;
+    for (int b = 0; b < x_bins * y_bins; ++b)
+        max_count = ImMax(max_count, bin_counts[b]);
+    if (density) {
+        double scale = 1.0 / ((outliers ? count : counted) * width * height);
+        for (int b = 0; b < x_bins * y_bins; ++b)
+            bin_counts[b] *= scale;
+        max_count *= scale;
+    }
+    return max_count;
+}
+
+template <typename T>
+double ComputeHistogram(const T* values, int count, double* bin_counts, int bins, ImPlotRange range, ImPlotHistogramFlags flags, ImPlotParallelFor parallel_for, void* parallel_data) {
+    if (count <= 0 || bins <= 0)
+        return 0;
+    if (range.Min == 0 && range.Max == 0) {
+        T min, max;
+        ImMinMaxArray(values, count, &min, &max);
+        range = ImPlotRange((double)min, (double)max);
+    }
+    ImVector<int> scratch;
+    return CalcHistogram(values, count, bin_counts, bins, range, range.Size() / bins, flags, scratch, parallel_for, parallel_data);
+}
+#define INSTANTIATE_MACRO(T) template IMPLOT_API double ComputeHistogram<T>(const T* values, int count, double* bin_counts, int bins, ImPlotRange range, ImPlotHistogramFlags flags, ImPlotParallelFor parallel_for, void* parallel_data);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
+template <typename T>
+double PlotHistogram(const char* label_id, const T* values, int count, int bins, double bar_scale, ImPlotRange range, ImPlotHistogramFlags flags) {
+
+    if (count <= 0 || bins == 0)
+        return 0;
+
+    if (range.Min == 0 && range.Max == 0)
+        range = CalcArrayExtents(values, count, ImHasFlag(flags, ImPlotItemFlags_CacheExtents));
+
+    double width;
+    if (bins < 0)
+        CalculateBins(values, count, bins, range, bins, width);
+    else
+        width = range.Size() / bins;
+
+    ImPlotContext& gp = *GImPlot;
+    ImVector<double>& bin_centers = gp.TempDouble1;
+    ImVector<double>& bin_counts  = gp.TempDouble2;
+    bin_centers.resize(bins);
+    bin_counts.resize(bins);
+
+    for (int b = 0; b < bins; ++b)
+        bin_centers[b] = range.Min + b * width + width * 0.5;
+    const bool parallel = count >= gp.ParallelMinPrims;
+    const double max_count = CalcHistogram(values, count, bin_counts.Data, bins, range, width, flags, gp.TempInt1, parallel ? gp.ParallelFor : nullptr, gp.ParallelForData);
     if (ImHasFlag(flags, ImPlotHistogramFlags_Horizontal))
         PlotBars(label_id, &bin_counts.Data[0], &bin_centers.Data[0], bins, bar_scale*width, ImPlotBarsFlags_Horizontal);
     else
@@ -2587,29 +5164,53 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 // [SECTION] PlotHistogram2D
 //-----------------------------------------------------------------------------
 
+template <typename T>
+double ComputeHistogram2D(const T* xs, const T* ys, int count, double* bin_counts, int x_bins, int y_bins, ImPlotRect range, ImPlotHistogramFlags flags, ImPlotParallelFor parallel_for, void* parallel_data) {
+    if (count <= 0 || x_bins <= 0 || y_bins <= 0)
+        return 0;
+    T min, max;
+    if (range.X.Min == 0 && range.X.Max == 0) {
+        ImMinMaxArray(xs, count, &min, &max);
+        range.X = ImPlotRange((double)min, (double)max);
+    }
+    if (range.Y.Min == 0 && range.Y.Max == 0) {
+        ImMinMaxArray(ys, count, &min, &max);
+        range.Y = ImPlotRange((double)min, (double)max);
+    }
+    ImVector<int> scratch;
+    const double max_count = CalcHistogram2D(xs, ys, count, bin_counts, x_bins, y_bins, range, range.X.Size() / x_bins, range.Y.Size() / y_bins, flags, scratch, parallel_for, parallel_data);
+    // flip the rows so that row 0 is the top of #range, as PlotHeatmap draws it
+    if (ImHasFlag(flags, ImPlotHistogramFlags_ColMajor)) {
+        // read column major, like PlotHistogram2D does, each run of #y_bins counts is one column
+        for (int c = 0; c < x_bins; ++c) {
+            for (int top = c * y_bins, bot = top + y_bins - 1; top < bot; ++top, --bot)
+                ImSwap(bin_counts[top], bin_counts[bot]);
+        }
+    }
+    else {
+        for (int top = 0, bot = y_bins - 1; top < bot; ++top, --bot) {
+            for (int b = 0; b < x_bins; ++b)
+                ImSwap(bin_counts[top * x_bins + b], bin_counts[bot * x_bins + b]);
+        }
+    }
+    return max_count;
+}
+#define INSTANTIATE_MACRO(T) template IMPLOT_API double ComputeHistogram2D<T>(const T* xs, const T* ys, int count, double* bin_counts, int x_bins, int y_bins, ImPlotRect range, ImPlotHistogramFlags flags, ImPlotParallelFor parallel_for, void* parallel_data);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
+
 template <typename T>
 double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count, int x_bins, int y_bins, ImPlotRect range, ImPlotHistogramFlags flags) {
 
-    // const bool cumulative = ImHasFlag(flags, ImPlotHistogramFlags_Cumulative); NOT SUPPORTED
-    const bool density  = ImHasFlag(flags, ImPlotHistogramFlags_Density);
-    const bool outliers = !ImHasFlag(flags, ImPlotHistogramFlags_NoOutliers);
-    const bool col_maj  = ImHasFlag(flags, ImPlotHistogramFlags_ColMajor);
+    const bool col_maj = ImHasFlag(flags, ImPlotHistogramFlags_ColMajor);
 
     if (count <= 0 || x_bins == 0 || y_bins == 0)
         return 0;
 
-    if (range.X.Min == 0 && range.X.Max == 0) {
-        T Min, Max;
-        ImMinMaxArray(xs, count, &Min, &Max);
-        range.X.Min = (double)Min;
-        range.X.Max = (double)Max;
-    }
-    if (range.Y.Min == 0 && range.Y.Max == 0) {
-        T Min, Max;
-        ImMinMaxArray(ys, count, &Min, &Max);
-        range.Y.Min = (double)Min;
-        range.Y.Max = (double)Max;
-    }
+    if (range.X.Min == 0 && range.X.Max == 0)
+        range.X = CalcArrayExtents(xs, count, ImHasFlag(flags, ImPlotItemFlags_CacheExtents));
+    if (range.Y.Min == 0 && range.Y.Max == 0)
+        range.Y = CalcArrayExtents(ys, count, ImHasFlag(flags, ImPlotItemFlags_CacheExtents));
 
     double width, height;
     if (x_bins < 0)
@@ -2621,34 +5222,11 @@ double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count
     else
         height = range.Y.Size() / y_bins;
 
-    const int bins = x_bins * y_bins;
-
     ImPlotContext& gp = *GImPlot;
     ImVector<double>& bin_counts = gp.TempDouble1;
-    bin_counts.resize(bins);
-
-    for (int b = 0; b < bins; ++b)
-        bin_counts[b] = 0;
-
-    int counted = 0;
-    double max_count = 0;
-    for (int i = 0; i < count; ++i) {
-        if (range.Contains((double)xs[i], (double)ys[i])) {
-            const int xb = ImClamp( (int)((double)(xs[i] - range.X.Min) / width)  , 0, x_bins - 1);
-            const int yb = ImClamp( (int)((double)(ys[i] - range.Y.Min) / height) , 0, y_bins - 1);
-            const int b  = yb * x_bins + xb;
-            bin_counts[b] += 1.0;
-            if (bin_counts[b] > max_count)
-                max_count = bin_counts[b];
-            counted++;
-        }
-    }
-    if (density) {
-        double scale = 1.0 / ((outliers ? count : counted) * width * height);
-        for (int b = 0; b < bins; ++b)
-            bin_counts[b] *= scale;
-        max_count *= scale;
-    }
+    bin_counts.resize(x_bins * y_bins);
+    const bool parallel = count >= gp.ParallelMinPrims;
+    const double max_count = CalcHistogram2D(xs, ys, count, bin_counts.Data, x_bins, y_bins, range, width, height, flags, gp.TempInt1, parallel ? gp.ParallelFor : nullptr, gp.ParallelForData);
 
     if (BeginItemEx(label_id, FitterRect(range))) {
         if (y_bins <= 0 || x_bins <= 0) {
@@ -2671,13 +5249,145 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 
 // TODO: Make this behave like all the other plot types (.e. not fixed in y axis)
 
+// Number of frames a digital run index may go unused before it is discarded
+static const int DIGITAL_RUNS_MAX_IDLE_FRAMES = 60;
+
+// Runs of a digital signal, each starting at one of the samples listed in #starts and lasting until the next one
+template <typename _Getter>
+struct DigitalRunsIdx {
+    DigitalRunsIdx(const _Getter& getter, const int* starts, int count) : Getter(getter), Starts(starts), Count(count) { }
+    IMPLOT_INLINE double Start(int run) const { return Getter(Starts[run]).x; }
+    IMPLOT_INLINE double Value(int run) const { return Getter(Starts[run]).y; }
+    IMPLOT_INLINE double End(int run) const   { return Getter(run + 1 < Count ? Starts[run + 1] : Getter.Count - 1).x; }
+    const _Getter& Getter;
+    const int* const Starts;
+    const int Count;
+};
+
+// Runs of a digital signal, each starting at one of the samples of #getter and lasting until the next one, or until #x_end for the last one
+template <typename _Getter>
+struct DigitalRunsEdges {
+    DigitalRunsEdges(const _Getter& getter, double x_end) : Getter(getter), XEnd(x_end), Count(getter.Count) { }
+    IMPLOT_INLINE double Start(int run) const { return Getter(run).x; }
+    IMPLOT_INLINE double Value(int run) const { return Getter(run).y; }
+    IMPLOT_INLINE double End(int run) const   { return run + 1 < Count ? Getter(run + 1).x : XEnd; }
+    const _Getter& Getter;
+    const double XEnd;
+    const int Count;
+};
+
+// Gets the cached runs of a digital signal, discarding those of signals which are no longer plotted.
+static ImPlotDigitalRuns& GetDigitalRunsEntry(ImGuiID key) {
+    ImPlotContext& gp = *GImPlot;
+    // discard the indices of signals which are no longer plotted, once per frame
+    const int frame = ImGui::GetFrameCount();
+    if (gp.DigitalRunsFrame != frame) {
+        gp.DigitalRunsFrame = frame;
+        for (int i = 0; i < gp.DigitalRuns.GetMapSize(); ++i) {
+            ImPlotDigitalRuns* runs = gp.DigitalRuns.TryGetMapData(i);
+            if (runs != nullptr && frame - runs->LastFrame > DIGITAL_RUNS_MAX_IDLE_FRAMES)
+                gp.DigitalRuns.Remove(gp.DigitalRuns.Map.Data[i].key, runs);
+        }
+    }
+    ImPlotDigitalRuns& runs = *gp.DigitalRuns.GetOrAddByKey(key);
+    runs.LastFrame = frame;
+    return runs;
+}
+
+// Gets the run index of a digital signal, finding the samples where its value changes if it isn't cached yet.
+template <typename _Getter>
+const ImPlotDigitalRuns& GetDigitalRuns(const _Getter& getter, ImGuiID key, const void* data) {
+    ImPlotDigitalRuns& runs = GetDigitalRunsEntry(key);
+    if (runs.Starts.Size == 0) {
+        runs.Data     = data;
+        runs.MaxValue = 0;
+        double prev   = 0;
+        for (int i = 0; i < getter.Count; ++i) {
+            const double y = getter(i).y;
+            // NaNs make up a single run
+            if (i == 0 || !(y == prev || (y != y && prev != prev))) {
+                runs.Starts.push_back(i);
+                if (!ImNanOrInf(y))
+                    runs.MaxValue = ImMax(runs.MaxValue, y);
+            }
+            prev = y;
+        }
+        runs.Count = getter.Count;
+    }
+    return runs;
+}
+
+// Gets the largest value of a digital signal given as edges, scanning only the edges appended since it was last plotted.
+template <typename _Getter>
+double GetDigitalEdgesMax(const _Getter& getter, ImGuiID key, const void* data) {
+    ImPlotDigitalRuns& runs = GetDigitalRunsEntry(key);
+    if (getter.Count < runs.Count || runs.Data != data) {
+        runs.Data     = data;
+        runs.MaxValue = 0;
+        runs.Count    = 0;
+    }
+    for (int i = runs.Count; i < getter.Count; ++i) {
+        const double y = getter(i).y;
+        if (!ImNanOrInf(y))
+            runs.MaxValue = ImMax(runs.MaxValue, y);
+    }
+    runs.Count = getter.Count;
+    return runs.MaxValue;
+}
+
+// Renders the runs of a digital signal which overlap the visible x range, one rect per run. Returns the height of the channel.
+template <typename _Runs>
+int RenderDigitalRuns(const _Runs& runs, double max_value) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotPlot& plot   = *gp.CurrentPlot;
+    ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+    ImPlotAxis& y_axis = plot.Axes[plot.CurrentY];
+    ImDrawList& draw_list = *GetPlotDrawList();
+    const ImPlotNextItemData& s = GetItemData();
+    const ImU32 col = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
+    // first run which ends in the visible range
+    int lo = 0, hi = runs.Count - 1;
+    while (lo < hi) {
+        const int mid = lo + (hi - lo) / 2;
+        if (runs.End(mid) < x_axis.Range.Min)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    const int pixY_0 = (int)(s.LineWeight);
+    for (int r = lo; r < runs.Count; ++r) {
+        const double x1 = runs.Start(r);
+        if (x1 > x_axis.Range.Max)
+            break;
+        const double y = runs.Value(r);
+        if (ImNanOrInf(y))
+            continue;
+        const int pixY_1 = (int)(s.DigitalBitHeight * (float)ImMax(0.0, y));
+        ImVec2 pMin(x_axis.PlotToPixels(x1),          y_axis.PixelMin - gp.DigitalPlotOffset);
+        ImVec2 pMax(x_axis.PlotToPixels(runs.End(r)), y_axis.PixelMin - gp.DigitalPlotOffset - pixY_0 - pixY_1);
+        //do not extend plot outside plot range
+        if (pMin.x < x_axis.PixelMin) pMin.x = x_axis.PixelMin;
+        if (pMax.x < x_axis.PixelMin) pMax.x = x_axis.PixelMin;
+        if (pMin.x > x_axis.PixelMax) pMin.x = x_axis.PixelMax - 1; //fix issue related to https://github.com/ocornut/imgui/issues/3976
+        if (pMax.x > x_axis.PixelMax) pMax.x = x_axis.PixelMax - 1; //fix issue related to https://github.com/ocornut/imgui/issues/3976
+        if ((pMax.x > pMin.x) && (plot.PlotRect.Contains(pMin) || plot.PlotRect.Contains(pMax)))
+            draw_list.AddRectFilled(pMin, pMax, col);
+    }
+    return (int)(ImMax(s.DigitalBitHeight, s.DigitalBitHeight * (float)ImMax(0.0, max_value)) + s.DigitalBitGap);
+}
+
 template <typename Getter>
-void PlotDigitalEx(const char* label_id, Getter getter, ImPlotDigitalFlags flags) {
+void PlotDigitalEx(const char* label_id, Getter getter, ImPlotDigitalFlags flags, ImGuiID runs_key = 0, const void* data = nullptr) {
     if (BeginItem(label_id, flags, ImPlotCol_Fill)) {
         ImPlotContext& gp = *GImPlot;
         ImDrawList& draw_list = *GetPlotDrawList();
         const ImPlotNextItemData& s = GetItemData();
-        if (getter.Count > 1 && s.RenderFill) {
+        if (getter.Count > 1 && s.RenderFill && runs_key != 0) {
+            const ImPlotDigitalRuns& runs = GetDigitalRuns(getter, runs_key, data);
+            gp.DigitalPlotItemCnt++;
+            gp.DigitalPlotOffset += RenderDigitalRuns(DigitalRunsIdx<Getter>(getter, runs.Starts.Data, runs.Starts.Size), runs.MaxValue);
+        }
+        else if (getter.Count > 1 && s.RenderFill) {
             ImPlotPlot& plot   = *gp.CurrentPlot;
             ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
             ImPlotAxis& y_axis = plot.Axes[plot.CurrentY];
@@ -2734,7 +5444,12 @@ void PlotDigitalEx(const char* label_id, Getter getter, ImPlotDigitalFlags flags
 template <typename T>
 void PlotDigital(const char* label_id, const T* xs, const T* ys, int count, ImPlotDigitalFlags flags, int offset, int stride) {
     GetterXY<IndexerIdx<T>,IndexerIdx<T>> getter(IndexerIdx<T>(xs,count,offset,stride),IndexerIdx<T>(ys,count,offset,stride),count);
-    return PlotDigitalEx(label_id, getter, flags);
+    ImGuiID runs_key = 0;
+    if (ImHasFlag(flags, ImPlotDigitalFlags_Transitions)) {
+        const int layout[4] = { count, offset, stride, (int)sizeof(T) };
+        runs_key = ImHashData(layout, sizeof(layout), ImHashData(&ys, sizeof(ys)));
+    }
+    return PlotDigitalEx(label_id, getter, flags, runs_key, ys);
 }
 #define INSTANTIATE_MACRO(T) template IMPLOT_API void PlotDigital<T>(const char* label_id, const T* xs, const T* ys, int count, ImPlotDigitalFlags flags, int offset, int stride);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
@@ -2743,8 +5458,33 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 // custom
 void PlotDigitalG(const char* label_id, ImPlotGetter getter_func, void* data, int count, ImPlotDigitalFlags flags) {
     GetterFuncPtr getter(getter_func,data,count);
-    return PlotDigitalEx(label_id, getter, flags);
+    ImGuiID runs_key = 0;
+    if (ImHasFlag(flags, ImPlotDigitalFlags_Transitions)) {
+        const void* ptrs[2] = { (const void*)getter_func, data };
+        runs_key = ImHashData(&count, sizeof(count), ImHashData(ptrs, sizeof(ptrs)));
+    }
+    return PlotDigitalEx(label_id, getter, flags, runs_key, data);
+}
+
+template <typename T>
+void PlotDigitalEdges(const char* label_id, const T* xs, const T* ys, int count, double x_end, ImPlotDigitalFlags flags, int offset, int stride) {
+    if (BeginItem(label_id, flags, ImPlotCol_Fill)) {
+        ImPlotContext& gp = *GImPlot;
+        const ImPlotNextItemData& s = GetItemData();
+        if (count > 0 && s.RenderFill) {
+            GetterXY<IndexerIdx<T>,IndexerIdx<T>> getter(IndexerIdx<T>(xs,count,offset,stride),IndexerIdx<T>(ys,count,offset,stride),count);
+            const int layout[3] = { offset, stride, (int)sizeof(T) };
+            const ImGuiID key = ImHashData(layout, sizeof(layout), ImHashData(&ys, sizeof(ys), ImHashStr("PlotDigitalEdges")));
+            const double max_value = GetDigitalEdgesMax(getter, key, ys);
+            gp.DigitalPlotItemCnt++;
+            gp.DigitalPlotOffset += RenderDigitalRuns(DigitalRunsEdges<GetterXY<IndexerIdx<T>,IndexerIdx<T>>>(getter, x_end), max_value);
+        }
+        EndItem();
+    }
 }
+#define INSTANTIATE_MACRO(T) template IMPLOT_API void PlotDigitalEdges<T>(const char* label_id, const T* xs, const T* ys, int count, double x_end, ImPlotDigitalFlags flags, int offset, int stride);
+CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
+#undef INSTANTIATE_MACRO
 
 //-----------------------------------------------------------------------------
 // [SECTION] PlotImage